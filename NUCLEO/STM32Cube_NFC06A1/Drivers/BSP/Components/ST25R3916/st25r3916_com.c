@@ -82,6 +82,14 @@
 static uint8_t  comBuf[ST25R3916_BUF_LEN];                             /*!< ST25R3916 communication buffer                                 */
 static uint16_t comBufIt;                                              /*!< ST25R3916 communication buffer iterator                        */
 #endif /* ST25R_COM_SINGLETXRX */
+
+#ifdef ST25R_COM_PROFILE
+static st25r3916ComProfile comProfile[ST25R3916_COM_PHASE_NUM][ST25R3916_COM_OP_NUM]; /*!< SPI traffic per phase and operation kind            */
+static uint8_t  comProfPhase;                                          /*!< Phase the traffic is attributed to                     */
+static uint8_t  comProfOp;                                             /*!< Operation kind of the current chip select cycle        */
+static uint16_t comProfBytes;                                          /*!< Bytes clocked in the current chip select cycle         */
+static uint16_t comProfStartUs;                                        /*!< Start of the current chip select cycle                 */
+#endif /* ST25R_COM_PROFILE */
     
 /*
  ******************************************************************************
@@ -168,6 +176,24 @@ static void st25r3916comRx( uint8_t* rxBuf, uint16_t rxLen );
  */
 static void st25r3916comTxByte( uint8_t txByte, bool last, bool txOnly );
 
+/*!
+ ******************************************************************************
+ * \brief ST25R3916 communication profile accounting
+ * 
+ * Counts the bytes of the current chip select cycle and, on its first
+ * byte, determines the operation kind
+ * 
+ * \param[in]  buf : the buffer being transmitted, NULL when receiving
+ * \param[in]  len : number of bytes clocked
+ *  
+ ******************************************************************************
+ */
+#ifdef ST25R_COM_PROFILE
+static void st25r3916comProfileBytes( const uint8_t* buf, uint16_t len );
+#else
+#define st25r3916comProfileBytes( buf, len )
+#endif /* ST25R_COM_PROFILE */
+
 
 /*
  ******************************************************************************
@@ -192,7 +218,11 @@ static void st25r3916comStart( void )
     #endif /* ST25R_COM_SINGLETXRX */
     
 #endif /* RFAL_USE_I2C */
-    
+
+#ifdef ST25R_COM_PROFILE
+    comProfBytes   = 0;
+    comProfStartUs = platformGetSysTickUs();
+#endif /* ST25R_COM_PROFILE */
 }
 
 
@@ -206,6 +236,13 @@ static void st25r3916comStop( void )
     /* Release the chip select */
     platformSpiDeselect();
 #endif /* RFAL_USE_I2C */
+
+#ifdef ST25R_COM_PROFILE
+    /* Still protected, the interrupt handler cannot update the counters meanwhile */
+    comProfile[comProfPhase][comProfOp].csCycles++;
+    comProfile[comProfPhase][comProfOp].bytes += comProfBytes;
+    comProfile[comProfPhase][comProfOp].us    += (uint16_t)(platformGetSysTickUs() - comProfStartUs);
+#endif /* ST25R_COM_PROFILE */
     
     /* reEnable the ST25R3916 interrupt */
     platformUnprotectST25RComm();
@@ -230,6 +267,8 @@ static void st25r3916comTx( const uint8_t* txBuf, uint16_t txLen, bool last, boo
     
     if( txLen > 0U )
     {
+        st25r3916comProfileBytes( txBuf, txLen );
+        
 #ifdef RFAL_USE_I2C
         platformI2CTx( txBuf, txLen, last, txOnly );
 #else /* RFAL_USE_I2C */
@@ -258,6 +297,8 @@ static void st25r3916comRx( uint8_t* rxBuf, uint16_t rxLen )
 {
     if( rxLen > 0U )
     {
+        st25r3916comProfileBytes( NULL, rxLen );
+        
 #ifdef RFAL_USE_I2C
         platformI2CRx( rxBuf, rxLen );
 #else /* RFAL_USE_I2C */
@@ -285,6 +326,36 @@ static void st25r3916comTxByte( uint8_t txByte, bool last, bool txOnly )
     st25r3916comTx( &val, ST25R3916_REG_LEN, last, txOnly );
 }
 
+
+/*******************************************************************************/
+#ifdef ST25R_COM_PROFILE
+static void st25r3916comProfileBytes( const uint8_t* buf, uint16_t len )
+{
+    if( (comProfBytes == 0U) && (buf != NULL) )
+    {
+        if( (buf[0] == ST25R3916_FIFO_LOAD) || (buf[0] == ST25R3916_FIFO_READ) )
+        {
+            comProfOp = ST25R3916_COM_OP_FIFO;
+        }
+        else if( (buf[0] >= ST25R3916_PT_A_CONFIG_LOAD) && (buf[0] <= ST25R3916_PT_MEM_READ) )
+        {
+            comProfOp = ST25R3916_COM_OP_PTMEM;
+        }
+        else if( ((buf[0] & ST25R3916_CMD_MODE) == ST25R3916_CMD_MODE) 
+              && (buf[0] != ST25R3916_CMD_SPACE_B_ACCESS) && (buf[0] != ST25R3916_CMD_TEST_ACCESS) )
+        {
+            comProfOp = ST25R3916_COM_OP_CMD;
+        }
+        else
+        {
+            comProfOp = ST25R3916_COM_OP_REG;                          /* register read/write, space B and test access */
+        }
+    }
+    
+    comProfBytes += len;
+}
+#endif /* ST25R_COM_PROFILE */
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -629,6 +700,38 @@ bool st25r3916CheckReg( uint8_t reg, uint8_t mask, uint8_t val )
 }
 
 
+/*******************************************************************************/
+#ifdef ST25R_COM_PROFILE
+uint8_t st25r3916comSetPhase( uint8_t phase )
+{
+    uint8_t prev = comProfPhase;
+    
+    comProfPhase = ((phase < ST25R3916_COM_PHASE_NUM) ? phase : ST25R3916_COM_PHASE_OTHER);
+    return prev;
+}
+
+
+/*******************************************************************************/
+const st25r3916ComProfile* st25r3916comGetProfile( uint8_t phase, uint8_t op )
+{
+    if( (phase >= ST25R3916_COM_PHASE_NUM) || (op >= ST25R3916_COM_OP_NUM) )
+    {
+        return NULL;
+    }
+    return &comProfile[phase][op];
+}
+
+
+/*******************************************************************************/
+void st25r3916comClearProfile( void )
+{
+    platformProtectST25RComm();
+    ST_MEMSET( comProfile, 0x00, sizeof(comProfile) );
+    platformUnprotectST25RComm();
+}
+#endif /* ST25R_COM_PROFILE */
+
+
 /*******************************************************************************/
 bool st25r3916IsRegValid( uint8_t reg )
 {
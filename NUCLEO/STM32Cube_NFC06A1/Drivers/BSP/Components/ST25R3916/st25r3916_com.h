@@ -960,6 +960,34 @@
 
 /*! \endcond DOXYGEN_SUPRESS */
 
+#ifdef ST25R_COM_PROFILE
+
+/*! Phases the SPI traffic is attributed to, set by the RFAL and the application */
+#define ST25R3916_COM_PHASE_OTHER                             0U       /*!< Nothing more specific running                        */
+#define ST25R3916_COM_PHASE_DISCOVERY                         1U       /*!< NFC discovery worker                                 */
+#define ST25R3916_COM_PHASE_SET_MODE                          2U       /*!< rfalSetMode                                          */
+#define ST25R3916_COM_PHASE_TRANSCEIVE                        3U       /*!< Blocking transceive                                  */
+#define ST25R3916_COM_PHASE_ANALOG_CFG                        4U       /*!< Analog configuration                                 */
+#define ST25R3916_COM_PHASE_IRQ                               5U       /*!< ST25R3916 interrupt handler                          */
+#define ST25R3916_COM_PHASE_NUM                               6U       /*!< Number of phases                                     */
+
+/*! Kinds of SPI operation, taken from the first byte sent */
+#define ST25R3916_COM_OP_REG                                  0U       /*!< Register and test register access                    */
+#define ST25R3916_COM_OP_FIFO                                 1U       /*!< FIFO load and read                                   */
+#define ST25R3916_COM_OP_PTMEM                                2U       /*!< Passive target memory load and read                  */
+#define ST25R3916_COM_OP_CMD                                  3U       /*!< Direct command                                       */
+#define ST25R3916_COM_OP_NUM                                  4U       /*!< Number of operation kinds                            */
+
+/*! SPI traffic of one operation kind within one phase */
+typedef struct
+{
+    uint32_t csCycles;                                                 /*!< Chip select cycles                                   */
+    uint32_t bytes;                                                    /*!< Bytes clocked, command byte included                 */
+    uint32_t us;                                                       /*!< Time with chip select active                         */
+} st25r3916ComProfile;
+
+#endif /* ST25R_COM_PROFILE */
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -1308,6 +1336,46 @@ bool st25r3916CheckReg( uint8_t reg, uint8_t mask, uint8_t val );
  */
 bool st25r3916IsRegValid( uint8_t reg );
 
+#ifdef ST25R_COM_PROFILE
+
+/*! 
+ *****************************************************************************
+ *  \brief  Set the SPI profiling phase
+ *
+ *  Attributes all following SPI traffic to the given phase. Callers restore
+ *  the returned phase when done, so phases can be nested.
+ *
+ *  \param[in]  phase: ST25R3916_COM_PHASE_xxx
+ *  
+ *  \return  the phase that was active before
+ *
+ *****************************************************************************
+ */
+uint8_t st25r3916comSetPhase( uint8_t phase );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Get the SPI traffic of an operation kind within a phase
+ *
+ *  \param[in]  phase: ST25R3916_COM_PHASE_xxx
+ *  \param[in]  op   : ST25R3916_COM_OP_xxx
+ *  
+ *  \return  the counters, NULL if phase or op are out of range
+ *
+ *****************************************************************************
+ */
+const st25r3916ComProfile* st25r3916comGetProfile( uint8_t phase, uint8_t op );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Clear all SPI traffic counters
+ *
+ *****************************************************************************
+ */
+void st25r3916comClearProfile( void );
+
+#endif /* ST25R_COM_PROFILE */
+
 #endif /* ST25R3916_COM_H */
 
 
@@ -72,6 +72,12 @@ typedef struct
 
 static volatile st25r3916Interrupt   st25r3916interrupt; /*!< Instance of ST25R3916 interrupt */
 
+#ifdef platformGetCycleStamp
+static volatile uint32_t  st25r3916IsrStamp;   /*!< Cycle stamp of the latest interrupt status update          */
+static uint32_t           st25r3916WakeLast;   /*!< Cycles from status update to the sleeping waiter resuming  */
+static uint32_t           st25r3916WakeMax;    /*!< Worst case of st25r3916WakeLast                            */
+#endif /* platformGetCycleStamp */
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -93,6 +99,10 @@ void st25r3916InitInterrupts( void )
 /*******************************************************************************/
 void st25r3916Isr( void )
 {
+#ifdef ST25R_COM_PROFILE
+    uint8_t phase = st25r3916comSetPhase( ST25R3916_COM_PHASE_IRQ );
+#endif /* ST25R_COM_PROFILE */
+    
     st25r3916CheckForReceivedInterrupts();
     
     // Check if callback is set and run it
@@ -100,6 +110,10 @@ void st25r3916Isr( void )
     {
         st25r3916interrupt.callback();
     }
+    
+#ifdef ST25R_COM_PROFILE
+    st25r3916comSetPhase( phase );
+#endif /* ST25R_COM_PROFILE */
 }
 
 
@@ -130,6 +144,10 @@ void st25r3916CheckForReceivedInterrupts( void )
    st25r3916interrupt.status |= irqStatus;
    platformUnprotectST25RIrqStatus();
    
+#ifdef platformGetCycleStamp
+   st25r3916IsrStamp = platformGetCycleStamp();
+#endif /* platformGetCycleStamp */
+   
    /* Send an IRQ event to LED handling */
    st25r3916ledEvtIrq( st25r3916interrupt.status );
 }
@@ -166,6 +184,9 @@ uint32_t st25r3916WaitForInterruptsTimed( uint32_t mask, uint16_t tmo )
 {
     uint32_t tmrDelay;
     uint32_t status;
+#ifdef platformWaitForInterrupt
+    bool     slept = false;
+#endif /* platformWaitForInterrupt */
     
     tmrDelay = platformTimerCreate( tmo );
     
@@ -173,9 +194,27 @@ uint32_t st25r3916WaitForInterruptsTimed( uint32_t mask, uint16_t tmo )
     do 
     {
         status = (st25r3916interrupt.status & mask);
+        
+#ifdef platformWaitForInterrupt
+        /* Instead of spinning, sleep until the next interrupt: the ST25R3916 IRQ, the   *
+         * tick that expires the timer or any other source (e.g. UART) wakes the core   */
+        if( status == 0U )
+        {
+            platformWaitForInterrupt( (st25r3916interrupt.status & mask) == 0U );
+            slept = true;
+        }
+#endif /* platformWaitForInterrupt */
     } while( ( !platformTimerIsExpired( tmrDelay ) || (tmo == 0U)) && (status == 0U) );
     
     platformTimerDestroy( tmrDelay );
+    
+#if defined(platformWaitForInterrupt) && defined(platformGetCycleStamp)
+    if( slept && (status != 0U) )
+    {
+        st25r3916WakeLast = ((platformGetCycleStamp() + platformCycleStampPeriod()) - st25r3916IsrStamp) % platformCycleStampPeriod();
+        st25r3916WakeMax  = MAX( st25r3916WakeMax, st25r3916WakeLast );
+    }
+#endif /* platformWaitForInterrupt && platformGetCycleStamp */
 
     status = st25r3916interrupt.status & mask;
     
@@ -187,6 +226,20 @@ uint32_t st25r3916WaitForInterruptsTimed( uint32_t mask, uint16_t tmo )
 }
 
 
+/*******************************************************************************/
+void st25r3916GetWakeLatency( uint32_t *last, uint32_t *max )
+{
+#ifdef platformGetCycleStamp
+    *last = st25r3916WakeLast;
+    *max  = st25r3916WakeMax;
+    st25r3916WakeMax = 0;
+#else
+    *last = 0;
+    *max  = 0;
+#endif /* platformGetCycleStamp */
+}
+
+
 /*******************************************************************************/
 uint32_t st25r3916GetInterrupt( uint32_t mask )
 {
@@ -128,6 +128,21 @@
  */
 uint32_t st25r3916WaitForInterruptsTimed( uint32_t mask, uint16_t tmo );
 
+/*! 
+ *****************************************************************************
+ *  \brief  Get the wake-up latency of st25r3916WaitForInterruptsTimed
+ *
+ *  Reports the time, in core cycles, from the ISR updating the interrupt
+ *  status to the sleeping waiter resuming. The worst case is reset on read.
+ *  Both are 0 if the platform provides no cycle stamp.
+ *
+ *  \param[out] last : latency of the latest wake-up
+ *  \param[out] max  : worst latency since the previous call
+ *
+ *****************************************************************************
+ */
+void st25r3916GetWakeLatency( uint32_t *last, uint32_t *max );
+
 /*! 
  *****************************************************************************
  *  \brief  Get status for the given interrupt
@@ -98,6 +98,38 @@ void timerDelay( uint16_t tOut )
 }
 
 
+/*******************************************************************************/
+uint16_t timerCalculateTimerUs( uint16_t time )
+{
+  return (uint16_t)(platformGetSysTickUs() + time);
+}
+
+
+/*******************************************************************************/
+bool timerIsExpiredUs( uint16_t timer )
+{
+  /* Same signed difference as timerIsExpired() on the 16 bit us time base, *
+   * valid for timers up to 32767 us                                        */
+  if( (int16_t)(uint16_t)(timer - platformGetSysTickUs()) < 0 )
+  {
+    return true;
+  }
+  
+  return false;
+}
+
+
+/*******************************************************************************/
+void timerDelayUs( uint16_t tOut )
+{
+  uint16_t t;
+  
+  /* Calculate the timer and wait blocking until is running */
+  t = timerCalculateTimerUs( tOut );
+  while( !timerIsExpiredUs(t) );
+}
+
+
 /*******************************************************************************/
 void timerStopwatchStart( void )
 {
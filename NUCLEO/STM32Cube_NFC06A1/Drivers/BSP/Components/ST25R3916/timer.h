@@ -97,6 +97,45 @@ bool timerIsExpired( uint32_t timer );
 void timerDelay( uint16_t time );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  Calculate Timer in microseconds
+ *
+ * Same as timerCalculateTimer() but on the 16 bit microsecond time base.
+ *
+ * \param[in]  time : time/duration in Microseconds, max 32767
+ *
+ * \return u16 : The new timer calculated based on the given time 
+ *****************************************************************************
+ */
+uint16_t timerCalculateTimerUs( uint16_t time );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  Checks if a microsecond Timer is Expired
+ *
+ * \see timerCalculateTimerUs
+ *
+ * \param[in]  timer : the timer to check 
+ *
+ * \return true  : timer has already expired
+ * \return false : timer is still running
+ *****************************************************************************
+ */
+bool timerIsExpiredUs( uint16_t timer );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  Performs a Delay in microseconds
+ *
+ * \param[in]  time : time/duration in Microseconds of the delay, max 32767
+ *****************************************************************************
+ */
+void timerDelayUs( uint16_t time );
+
+
 /*! 
  *****************************************************************************
  * \brief  Stopwatch start
@@ -44,6 +44,9 @@
 #include "st_errno.h"
 #include "platform.h"
 #include "utils.h"
+#ifdef ST25R_COM_PROFILE
+#include "st25r3916_com.h"
+#endif /* ST25R_COM_PROFILE */
 
 
 /* Check whether the Default Analog settings are to be used or custom ones */
@@ -101,6 +104,7 @@ static rfalAnalogConfigMgmt   gRfalAnalogConfigMgmt;  /*!< Analog Configuration
  ******************************************************************************
  */
 static rfalAnalogConfigNum rfalAnalogConfigSearch( rfalAnalogConfigId configId, uint16_t *configOffset );
+static ReturnCode rfalAnalogConfigApply( rfalAnalogConfigId configId );
 
 #if RFAL_FEATURE_DYNAMIC_ANALOG_CONFIG
     static void rfalAnalogConfigPtrUpdate( const uint8_t* analogConfigTbl );
@@ -293,6 +297,25 @@ ReturnCode rfalAnalogConfigListRead( rfalAnalogConfigOffset *configOffset, uint8
 
 
 ReturnCode rfalSetAnalogConfig( rfalAnalogConfigId configId )
+{
+#ifdef ST25R_COM_PROFILE
+    ReturnCode ret;
+    uint8_t    phase;
+    
+    /* Attribute the register writes to the analog configuration */
+    phase = st25r3916comSetPhase( ST25R3916_COM_PHASE_ANALOG_CFG );
+    ret   = rfalAnalogConfigApply( configId );
+    st25r3916comSetPhase( phase );
+    
+    return ret;
+#else
+    return rfalAnalogConfigApply( configId );
+#endif /* ST25R_COM_PROFILE */
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalAnalogConfigApply( rfalAnalogConfigId configId )
 {
     rfalAnalogConfigOffset configOffset = 0;
     rfalAnalogConfigNum numConfigSet;
@@ -339,7 +362,7 @@ ReturnCode rfalSetAnalogConfig( rfalAnalogConfigId configId )
     
     return retCode;
     
-} /* rfalSetAnalogConfig() */
+} /* rfalAnalogConfigApply() */
 
 
 uint16_t rfalAnalogConfigGenModeID( rfalMode md, rfalBitRate br, uint16_t dir )
@@ -41,13 +41,6 @@
 */
 #include "rfal_crc.h"
 
-/*
-******************************************************************************
-* LOCAL FUNCTION PROTOTYPES
-******************************************************************************
-*/
-static uint16_t rfalCrcUpdateCcitt(uint16_t crcSeed, uint8_t dataByte);
-
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -66,12 +59,7 @@ uint16_t rfalCrcCalculateCcitt(uint16_t preloadValue, const uint8_t* buf, uint16
     return crc;
 }
 
-/*
-******************************************************************************
-* LOCAL FUNCTIONS
-******************************************************************************
-*/
-static uint16_t rfalCrcUpdateCcitt(uint16_t crcSeed, uint8_t dataByte)
+uint16_t rfalCrcUpdateCcitt(uint16_t crcSeed, uint8_t dataByte)
 {
     uint16_t crc = crcSeed;
     uint8_t  dat = dataByte;
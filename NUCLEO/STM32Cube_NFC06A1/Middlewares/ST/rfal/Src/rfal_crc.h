@@ -71,5 +71,21 @@
  */
 extern uint16_t rfalCrcCalculateCcitt(uint16_t preloadValue, const uint8_t* buf, uint16_t length);
 
+/*! 
+ *****************************************************************************
+ *  \brief  Update CRC according to CCITT standard with a single byte.
+ *
+ *  This function folds \a dataByte into the running CRC \a crcSeed, allowing
+ *  the CRC to be computed on the fly while a frame is being processed.
+ *
+ *  \param[in] crcSeed : current CRC value (preload value for the first byte).
+ *  \param[in] dataByte : byte to be added to the CRC.
+ *
+ *  \return 16 bit long crc value.
+ *
+ *****************************************************************************
+ */
+extern uint16_t rfalCrcUpdateCcitt(uint16_t crcSeed, uint8_t dataByte);
+
 #endif /* RFAL_CRC_H_ */
 
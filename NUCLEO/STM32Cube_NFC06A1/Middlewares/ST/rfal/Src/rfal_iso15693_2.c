@@ -84,6 +84,11 @@
 
 #define ISO15693_PHY_DAT_MANCHESTER_1 0xaaaa
 
+#define ISO15693_CODE_1_4_LEN    4U   /*!< Coded bytes per payload byte in 1 of 4 coding   */
+#define ISO15693_CODE_1_256_LEN  64U  /*!< Coded bytes per payload byte in 1 of 256 coding */
+
+#define ISO15693_CODE_1_4_NIBBLE( lo, hi )   ((uint16_t)((uint16_t)(lo) | ((uint16_t)(hi) << 8U)))  /*!< Coded word for the two bit pairs of a nibble */
+
 #define ISO15693_PHY_BIT_BUFFER_SIZE 1000 /*!< size of the receiving buffer. Might be adjusted if longer datastreams are expected. */
 
 
@@ -93,14 +98,56 @@
 ******************************************************************************
 */
 static iso15693PhyConfig_t iso15693PhyConfig; /*!< current phy configuration */
+static uint16_t            iso15693PhyTxCrc;  /*!< running CRC of the frame being coded by iso15693VCDCode() */
+
+/*! 1 of 4 coding table: indexed by a payload nibble, holds the 2 coded bytes (first pair in the low byte) */
+static const uint16_t iso15693PhyCode1Of4Tbl[16] = {
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_00_1_4, ISO15693_DAT_00_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_01_1_4, ISO15693_DAT_00_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_10_1_4, ISO15693_DAT_00_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_11_1_4, ISO15693_DAT_00_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_00_1_4, ISO15693_DAT_01_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_01_1_4, ISO15693_DAT_01_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_10_1_4, ISO15693_DAT_01_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_11_1_4, ISO15693_DAT_01_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_00_1_4, ISO15693_DAT_10_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_01_1_4, ISO15693_DAT_10_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_10_1_4, ISO15693_DAT_10_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_11_1_4, ISO15693_DAT_10_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_00_1_4, ISO15693_DAT_11_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_01_1_4, ISO15693_DAT_11_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_10_1_4, ISO15693_DAT_11_1_4 ),
+    ISO15693_CODE_1_4_NIBBLE( ISO15693_DAT_11_1_4, ISO15693_DAT_11_1_4 )
+};
+
+/*! Manchester decoding table: indexed by 4 received manchester pairs (LSB first), holds the 4 decoded *
+ *  data bits in the low nibble and a collision mask (pair 00 or 11) in the high nibble               */
+static const uint8_t iso15693PhyManchesterDecTbl[256] = {
+    0xF0U, 0xE0U, 0xE1U, 0xF0U, 0xD0U, 0xC0U, 0xC1U, 0xD0U, 0xD2U, 0xC2U, 0xC3U, 0xD2U, 0xF0U, 0xE0U, 0xE1U, 0xF0U,
+    0xB0U, 0xA0U, 0xA1U, 0xB0U, 0x90U, 0x80U, 0x81U, 0x90U, 0x92U, 0x82U, 0x83U, 0x92U, 0xB0U, 0xA0U, 0xA1U, 0xB0U,
+    0xB4U, 0xA4U, 0xA5U, 0xB4U, 0x94U, 0x84U, 0x85U, 0x94U, 0x96U, 0x86U, 0x87U, 0x96U, 0xB4U, 0xA4U, 0xA5U, 0xB4U,
+    0xF0U, 0xE0U, 0xE1U, 0xF0U, 0xD0U, 0xC0U, 0xC1U, 0xD0U, 0xD2U, 0xC2U, 0xC3U, 0xD2U, 0xF0U, 0xE0U, 0xE1U, 0xF0U,
+    0x70U, 0x60U, 0x61U, 0x70U, 0x50U, 0x40U, 0x41U, 0x50U, 0x52U, 0x42U, 0x43U, 0x52U, 0x70U, 0x60U, 0x61U, 0x70U,
+    0x30U, 0x20U, 0x21U, 0x30U, 0x10U, 0x00U, 0x01U, 0x10U, 0x12U, 0x02U, 0x03U, 0x12U, 0x30U, 0x20U, 0x21U, 0x30U,
+    0x34U, 0x24U, 0x25U, 0x34U, 0x14U, 0x04U, 0x05U, 0x14U, 0x16U, 0x06U, 0x07U, 0x16U, 0x34U, 0x24U, 0x25U, 0x34U,
+    0x70U, 0x60U, 0x61U, 0x70U, 0x50U, 0x40U, 0x41U, 0x50U, 0x52U, 0x42U, 0x43U, 0x52U, 0x70U, 0x60U, 0x61U, 0x70U,
+    0x78U, 0x68U, 0x69U, 0x78U, 0x58U, 0x48U, 0x49U, 0x58U, 0x5AU, 0x4AU, 0x4BU, 0x5AU, 0x78U, 0x68U, 0x69U, 0x78U,
+    0x38U, 0x28U, 0x29U, 0x38U, 0x18U, 0x08U, 0x09U, 0x18U, 0x1AU, 0x0AU, 0x0BU, 0x1AU, 0x38U, 0x28U, 0x29U, 0x38U,
+    0x3CU, 0x2CU, 0x2DU, 0x3CU, 0x1CU, 0x0CU, 0x0DU, 0x1CU, 0x1EU, 0x0EU, 0x0FU, 0x1EU, 0x3CU, 0x2CU, 0x2DU, 0x3CU,
+    0x78U, 0x68U, 0x69U, 0x78U, 0x58U, 0x48U, 0x49U, 0x58U, 0x5AU, 0x4AU, 0x4BU, 0x5AU, 0x78U, 0x68U, 0x69U, 0x78U,
+    0xF0U, 0xE0U, 0xE1U, 0xF0U, 0xD0U, 0xC0U, 0xC1U, 0xD0U, 0xD2U, 0xC2U, 0xC3U, 0xD2U, 0xF0U, 0xE0U, 0xE1U, 0xF0U,
+    0xB0U, 0xA0U, 0xA1U, 0xB0U, 0x90U, 0x80U, 0x81U, 0x90U, 0x92U, 0x82U, 0x83U, 0x92U, 0xB0U, 0xA0U, 0xA1U, 0xB0U,
+    0xB4U, 0xA4U, 0xA5U, 0xB4U, 0x94U, 0x84U, 0x85U, 0x94U, 0x96U, 0x86U, 0x87U, 0x96U, 0xB4U, 0xA4U, 0xA5U, 0xB4U,
+    0xF0U, 0xE0U, 0xE1U, 0xF0U, 0xD0U, 0xC0U, 0xC1U, 0xD0U, 0xD2U, 0xC2U, 0xC3U, 0xD2U, 0xF0U, 0xE0U, 0xE1U, 0xF0U
+};
 
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
-static ReturnCode iso15693PhyVCDCode1Of4(const uint8_t data, uint8_t* outbuffer, uint16_t maxOutBufLen, uint16_t* outBufLen);
-static ReturnCode iso15693PhyVCDCode1Of256(const uint8_t data, uint8_t* outbuffer, uint16_t maxOutBufLen, uint16_t* outBufLen);
+static void iso15693PhyVCDCode1Of4(uint8_t data, uint8_t* outbuf);
+static void iso15693PhyVCDCode1Of256(uint8_t data, uint8_t* outbuf);
 
 
 
@@ -147,139 +194,118 @@ ReturnCode iso15693VCDCode(uint8_t* buffer, uint16_t length, bool sendCrc, bool
                    uint16_t *subbit_total_length, uint16_t *offset,
                    uint8_t* outbuf, uint16_t outBufSize, uint16_t* actOutBufSize)
 {
-    ReturnCode err = ERR_NONE;
-    uint8_t eof, sof;
-    uint8_t transbuf[2];
-    uint16_t crc = 0;
-    ReturnCode (*txFunc)(const uint8_t data, uint8_t* outbuffer, uint16_t maxOutBufLen, uint16_t* outBufLen);
-    uint8_t crc_len;
-    uint8_t* outputBuf;
-    uint16_t outputBufSize;
+    uint8_t  eof, sof;
+    uint8_t  data;
+    uint8_t  crc_len;
+    uint16_t codedLen;  /* Coded bytes per payload byte */
+    uint16_t frameLen;  /* Payload bytes including CRC  */
+    uint16_t fit;       /* Payload bytes that fit in outbuf on this call */
+    uint16_t pos;
 
-    crc_len = (uint8_t)((sendCrc)?2:0);
+    crc_len  = (uint8_t)((sendCrc)?2:0);
+    frameLen = (length + (uint16_t)crc_len);
 
     *actOutBufSize = 0;
 
     if (ISO15693_VCD_CODING_1_4 == iso15693PhyConfig.coding)
     {
-        sof = ISO15693_DAT_SOF_1_4;
-        eof = ISO15693_DAT_EOF_1_4;
-        txFunc = iso15693PhyVCDCode1Of4;
-        *subbit_total_length = (
-                ( 1U  /* SOF */
-                  + ((length + (uint16_t)crc_len) * 4U)
-                  + 1U) /* EOF */
-                );
-        if (outBufSize < 5U) { /* 5 should be safe: enough for sof + 1byte data in 1of4 */
-            return ERR_NOMEM;
-        }
+        sof      = ISO15693_DAT_SOF_1_4;
+        eof      = ISO15693_DAT_EOF_1_4;
+        codedLen = ISO15693_CODE_1_4_LEN;
     }
     else
     {
-        sof = ISO15693_DAT_SOF_1_256;
-        eof = ISO15693_DAT_EOF_1_256;
-        txFunc = iso15693PhyVCDCode1Of256;
-        *subbit_total_length = (
-                ( 1U  /* SOF */
-                  + ((length + (uint16_t)crc_len) * 64U) 
-                  + 1U) /* EOF */
-                );
-
-        if (*offset != 0U)
-        {
-            if (outBufSize < 64U) { /* 64 should be safe: enough a single byte data in 1of256 */
-                return ERR_NOMEM;
-            }
-        }
-        else
-        {
-            if (outBufSize < 65U) { /* At beginning of a frame we need at least 65 bytes to start: enough for sof + 1byte data in 1of256 */
-                return ERR_NOMEM;
-            }
-        }
+        sof      = ISO15693_DAT_SOF_1_256;
+        eof      = ISO15693_DAT_EOF_1_256;
+        codedLen = ISO15693_CODE_1_256_LEN;
     }
 
+    *subbit_total_length = (
+            ( 1U  /* SOF */
+              + (frameLen * codedLen)
+              + 1U) /* EOF */
+            );
+
     if (length == 0U)
     {
         *subbit_total_length = 1;
     }
 
-    if ((length != 0U) && (0U == *offset) && sendFlags && !picopassMode)
+    /* Only the EOF is left to be sent, otherwise at least one payload byte (and SOF at beginning of a frame) must fit */
+    if (outBufSize < ((*offset >= frameLen) ? 1U : ((((0U == *offset) && (length != 0U)) ? 1U : 0U) + codedLen)))
     {
-        /* set high datarate flag */
-        buffer[0] |= (uint8_t)ISO15693_REQ_FLAG_HIGH_DATARATE;
-        /* clear sub-carrier flag - we only support single sub-carrier */
-        buffer[0] = (uint8_t)(buffer[0] & ~ISO15693_REQ_FLAG_TWO_SUBCARRIERS);  /* MISRA 10.3 */
+        return ERR_NOMEM;
     }
 
-    outputBuf = outbuf;             /* MISRA 17.8: Use intermediate variable */
-    outputBufSize = outBufSize;     /* MISRA 17.8: Use intermediate variable */
+    pos = 0;
 
-    /* Send SOF if at 0 offset */
     if ((length != 0U) && (0U == *offset))
     {
-        *outputBuf = sof; 
-        (*actOutBufSize)++;
-        outputBufSize--;
-        outputBuf++;
+        if (sendFlags && !picopassMode)
+        {
+            /* set high datarate flag */
+            buffer[0] |= (uint8_t)ISO15693_REQ_FLAG_HIGH_DATARATE;
+            /* clear sub-carrier flag - we only support single sub-carrier */
+            buffer[0] = (uint8_t)(buffer[0] & ~ISO15693_REQ_FLAG_TWO_SUBCARRIERS);  /* MISRA 10.3 */
+        }
+
+        /* Send SOF if at 0 offset */
+        outbuf[pos] = sof;
+        pos++;
     }
 
-    while ((*offset < length) && (err == ERR_NONE))
+    if (0U == *offset)
     {
-        uint16_t filled_size;
-        /* send data */
-        err = txFunc(buffer[*offset], outputBuf, outputBufSize, &filled_size);
-        (*actOutBufSize) += filled_size;
-        outputBuf = &outputBuf[filled_size];	/* MISRA 18.4: Avoid pointer arithmetic */
-        outputBufSize -= filled_size;
-        if (err == ERR_NONE) {
-            (*offset)++;
-        }
-    }
-    if (err != ERR_NONE) {
-        return ERR_AGAIN;
+        iso15693PhyTxCrc = ((picopassMode) ? 0xE012U : 0xFFFFU);    /* In PicoPass Mode a different Preset Value is used */
     }
 
-    while ((err == ERR_NONE) && sendCrc && (*offset < (length + 2U)))
+    /* Space is checked once for all the payload bytes coded on this call */
+    fit = MIN( (frameLen - MIN(*offset, frameLen)), ((outBufSize - pos) / codedLen) );
+
+    while (fit > 0U)
     {
-        uint16_t filled_size;
-        if (0U==crc)
+        if (*offset < length)
         {
-            crc = rfalCrcCalculateCcitt( (uint16_t) ((picopassMode) ? 0xE012U : 0xFFFFU),        /* In PicoPass Mode a different Preset Value is used   */
-                                                    ((picopassMode) ? (buffer + 1U) : buffer),   /* CMD byte is not taken into account in PicoPass mode */
-                                                    ((picopassMode) ? (length - 1U) : length));  /* CMD byte is not taken into account in PicoPass mode */
-            
-            crc = (uint16_t)((picopassMode) ? crc : ~crc);
+            data = buffer[*offset];
+
+            /* CMD byte is not taken into account in PicoPass mode */
+            if (!picopassMode || (*offset != 0U))
+            {
+                iso15693PhyTxCrc = rfalCrcUpdateCcitt(iso15693PhyTxCrc, data);
+            }
         }
-        /* send crc */
-        transbuf[0] = (uint8_t)(crc & 0xffU);
-        transbuf[1] = (uint8_t)((crc >> 8) & 0xffU);
-        err = txFunc(transbuf[*offset - length], outputBuf, outputBufSize, &filled_size);
-        (*actOutBufSize) += filled_size;
-        outputBuf = &outputBuf[filled_size];	/* MISRA 18.4: Avoid pointer arithmetic */
-        outputBufSize -= filled_size;
-        if (err == ERR_NONE) {
-            (*offset)++;
+        else
+        {
+            /* send crc, LSB first */
+            data = (uint8_t)((((picopassMode) ? iso15693PhyTxCrc : (uint16_t)~iso15693PhyTxCrc) >> ((*offset - length) * 8U)) & 0xffU);
         }
-    }
-    if (err != ERR_NONE) {
-        return ERR_AGAIN;
-    }
 
-    if ((!sendCrc && (*offset == length))
-            || (sendCrc && (*offset == (length + 2U))))
-    {
-        *outputBuf = eof; 
-        (*actOutBufSize)++;
-        outputBufSize--;
-        outputBuf++;
+        if (ISO15693_CODE_1_4_LEN == codedLen)
+        {
+            iso15693PhyVCDCode1Of4(data, &outbuf[pos]);
+        }
+        else
+        {
+            iso15693PhyVCDCode1Of256(data, &outbuf[pos]);
+        }
+
+        pos += codedLen;
+        (*offset)++;
+        fit--;
     }
-    else
+
+    if ((*offset < frameLen) || (pos >= outBufSize))
     {
+        *actOutBufSize = pos;
         return ERR_AGAIN;
     }
 
-    return err;
+    outbuf[pos] = eof;
+    pos++;
+
+    *actOutBufSize = pos;
+
+    return ERR_NONE;
 }
 
 ReturnCode iso15693VICCDecode(const uint8_t *inBuf,
@@ -292,9 +318,14 @@ ReturnCode iso15693VICCDecode(const uint8_t *inBuf,
                       bool picopassMode )
 {
     ReturnCode err = ERR_NONE;
-    uint16_t crc;
-    uint16_t mp; /* Current bit position in manchester bit inBuf*/
-    uint16_t bp; /* Current bit position in outBuf */
+    bool       isEOF = false;
+    uint16_t   crc;
+    uint16_t   grp;    /* Current group of 4 manchester pairs in inBuf, i.e. one output nibble */
+    uint16_t   bp;     /* Current bit position in outBuf */
+    uint32_t   bpMax;  /* Number of bits that fit in outBuf */
+    uint8_t    dec;    /* Decoded nibble (low) and collision mask (high) of the current group */
+    uint8_t    colMask;
+    uint8_t    man;
 
     *bitsBeforeCol = 0;
     *outBufPos = 0;
@@ -312,8 +343,9 @@ ReturnCode iso15693VICCDecode(const uint8_t *inBuf,
         return ERR_NONE;
     }
 
-    mp = 5; /* 5 bits were SOF, now manchester starts: 2 bits per payload bit */
-    bp = 0;
+    bp    = 0;
+    bpMax = ((uint32_t)outBufLen * 8U);
+    crc   = ((picopassMode) ? 0xE012U : 0xFFFFU);
 
     ST_MEMSET(outBuf,0,outBufLen);
 
@@ -322,50 +354,84 @@ ReturnCode iso15693VICCDecode(const uint8_t *inBuf,
         return ERR_CRC;
     }
 
-    for ( ; mp < ((inBufLen * 8U) - 2U); mp+=2U )
+    /* 5 bits were SOF, so each group of 4 manchester pairs takes bits 5..7 of *
+     * inBuf[grp] and bits 0..4 of inBuf[grp+1]. The last group is incomplete  *
+     * and only its first pair is decoded, as done by the bitwise decoding     */
+    for (grp = 0; grp < (inBufLen - 1U); grp++)
     {
-        bool isEOF = false;
-        
-        uint8_t man;
-        man  = (inBuf[mp/8U] >> (mp%8U)) & 0x1U;
-        man |= ((inBuf[(mp+1U)/8U] >> ((mp+1U)%8U)) & 0x1U) << 1;
-        if (1U == man)
-        {
-            bp++;
-        }
-        if (2U == man)
+        dec     = iso15693PhyManchesterDecTbl[(uint8_t)((inBuf[grp] >> 5U) | (inBuf[grp + 1U] << 3U))];
+        colMask = (dec >> 4U);
+
+        if (colMask != 0U)
         {
-            outBuf[bp/8U] = (uint8_t)(outBuf[bp/8U] | (1U <<(bp%8U)));  /* MISRA 10.3 */
-            bp++;
+            if (ignoreBits > bp)
+            { /* ignored collisions: leave as 0 */
+                colMask = ((ignoreBits >= (bp + 4U)) ? 0U : (uint8_t)(colMask & ~((1U << (ignoreBits - bp)) - 1U)));
+            }
+
+            if (colMask != 0U)
+            { /* Keep the bits received before the first collision */
+                man = 0;
+                while (((colMask >> man) & 0x1U) == 0U)
+                {
+                    man++;
+                }
+                outBuf[bp/8U] = (uint8_t)(outBuf[bp/8U] | ((dec & ((1U << man) - 1U)) << (bp%8U)));  /* MISRA 10.3 */
+                bp += man;
+                err = ERR_RF_COLLISION;
+                break;
+            }
         }
+
+        outBuf[bp/8U] = (uint8_t)(outBuf[bp/8U] | ((dec & 0x0FU) << (bp%8U)));  /* MISRA 10.3 */
+        bp += 4U;
+
         if ((bp%8U) == 0U)
-        { /* Check for EOF */
-            ISO_15693_DEBUG("ceof %hhx %hhx\n", inBuf[mp/8U], inBuf[mp/8+1]);
-            if ( ((inBuf[mp/8U]   & 0xe0U) == 0xa0U)
-               &&(inBuf[(mp/8U)+1U] == 0x03U))
+        {
+            /* CRC is computed on the fly, lagging two bytes behind so that the received CRC is not included */
+            if (bp >= 24U)
+            {
+                crc = rfalCrcUpdateCcitt(crc, outBuf[(bp/8U) - 3U]);
+            }
+
+            /* Check for EOF, only possible if the last pair was not a collision */
+            ISO_15693_DEBUG("ceof %hhx\n", inBuf[grp+1U]);
+            if ( ((dec & 0x80U) == 0U)
+               &&((inBuf[grp+1U] & 0xe0U) == 0xa0U)
+               &&((grp + 2U) < inBufLen)
+               &&(inBuf[grp+2U] == 0x03U))
             { /* Now we know that it was 10111000 = EOF */
                 ISO_15693_DEBUG("EOF\n");
                 isEOF = true;
+                break;
             }
         }
-        if ( ((0U == man) || (3U == man)) && !isEOF )
-        {  
-            if (bp >= ignoreBits)
-            {
-                err = ERR_RF_COLLISION;
-            }
-            else
-            {
-                /* ignored collision: leave as 0 */
-                bp++;
-            }
-        }
-        if ( (bp >= (outBufLen * 8U)) || (err == ERR_RF_COLLISION) || isEOF )        
+
+        if (bp >= bpMax)
         { /* Don't write beyond the end */
             break;
         }
     }
 
+    if ((err == ERR_NONE) && !isEOF && (bp < bpMax))
+    {
+        /* Last manchester pair, in bits 5..6 of the last byte */
+        man = ((inBuf[inBufLen - 1U] >> 5U) & 0x3U);
+        if (2U == man)
+        {
+            outBuf[bp/8U] = (uint8_t)(outBuf[bp/8U] | (1U <<(bp%8U)));  /* MISRA 10.3 */
+            bp++;
+        }
+        else if ((1U == man) || (bp < ignoreBits))
+        {
+            bp++;
+        }
+        else
+        {
+            err = ERR_RF_COLLISION;
+        }
+    }
+
     *outBufPos = (bp / 8U);
     *bitsBeforeCol = bp;
 
@@ -382,10 +448,6 @@ ReturnCode iso15693VICCDecode(const uint8_t *inBuf,
     if (*outBufPos > 2U)
     {
         /* finally, check crc */
-        ISO_15693_DEBUG("Calculate CRC, val: 0x%x, outBufLen: ", *outBuf);
-        ISO_15693_DEBUG("0x%x ", *outBufPos - 2);
-        
-        crc = rfalCrcCalculateCcitt(((picopassMode) ? 0xE012U : 0xFFFFU), outBuf, *outBufPos - 2U);
         crc = (uint16_t)((picopassMode) ? crc : ~crc);
         
         if (((crc & 0xffU) == outBuf[*outBufPos-2U]) &&
@@ -416,118 +478,45 @@ ReturnCode iso15693VICCDecode(const uint8_t *inBuf,
 */
 /*! 
  *****************************************************************************
- *  \brief  Perform 1 of 4 coding and send coded data
- *
- *  This function takes \a length bytes from \a buffer, perform 1 of 4 coding
- *  (see ISO15693-2 specification) and sends the data using stream mode.
+ *  \brief  Perform 1 of 4 coding
  *
- *  \param[in] sendSof : send SOF prior to data.
- *  \param[in] buffer : data to send.
- *  \param[in] length : number of bytes to send.
+ *  This function codes \a data into 4 bytes using 1 of 4 coding (see
+ *  ISO15693-2 specification), one table lookup per nibble.
  *
- *  \return ERR_IO : Error during communication.
- *  \return ERR_NONE : No error.
+ *  \param[in]  data   : byte to be coded.
+ *  \param[out] outbuf : output buffer, at least 4 bytes long.
  *
  *****************************************************************************
  */
-static ReturnCode iso15693PhyVCDCode1Of4(const uint8_t data, uint8_t* outbuffer, uint16_t maxOutBufLen, uint16_t* outBufLen)
+static void iso15693PhyVCDCode1Of4(uint8_t data, uint8_t* outbuf)
 {
-    uint8_t tmp;
-    ReturnCode err = ERR_NONE;
-    uint16_t a;
-    uint8_t* outbuf = outbuffer;
+    uint16_t code;
 
-    *outBufLen = 0;
+    code      = iso15693PhyCode1Of4Tbl[data & 0x0FU];
+    outbuf[0] = (uint8_t)(code & 0xffU);
+    outbuf[1] = (uint8_t)(code >> 8U);
 
-    if (maxOutBufLen < 4U) {
-        return ERR_NOMEM;
-    }
-
-    tmp = data;
-    for (a = 0; a < 4U; a++)
-    {
-        switch (tmp & 0x3U)
-        {
-            case 0:
-                *outbuf = ISO15693_DAT_00_1_4;
-                break;
-            case 1:
-                *outbuf = ISO15693_DAT_01_1_4;
-                break;
-            case 2:
-                *outbuf = ISO15693_DAT_10_1_4;
-                break;
-            case 3:
-                *outbuf = ISO15693_DAT_11_1_4;
-                break;
-            default:
-                /* MISRA 16.4: mandatory default statement */
-                break;
-        }
-        outbuf++;
-        (*outBufLen)++;
-        tmp >>= 2;
-    }
-    return err;
+    code      = iso15693PhyCode1Of4Tbl[data >> 4U];
+    outbuf[2] = (uint8_t)(code & 0xffU);
+    outbuf[3] = (uint8_t)(code >> 8U);
 }
 
 /*! 
  *****************************************************************************
- *  \brief  Perform 1 of 256 coding and send coded data
+ *  \brief  Perform 1 of 256 coding
  *
- *  This function takes \a length bytes from \a buffer, perform 1 of 256 coding
- *  (see ISO15693-2 specification) and sends the data using stream mode.
- *  \note This function sends SOF prior to the data.
+ *  This function codes \a data into 64 bytes using 1 of 256 coding (see
+ *  ISO15693-2 specification): a single pulse in the slot given by \a data.
  *
- *  \param[in] sendSof : send SOF prior to data.
- *  \param[in] buffer : data to send.
- *  \param[in] length : number of bytes to send.
- *
- *  \return ERR_IO : Error during communication.
- *  \return ERR_NONE : No error.
+ *  \param[in]  data   : byte to be coded.
+ *  \param[out] outbuf : output buffer, at least 64 bytes long.
  *
  *****************************************************************************
  */
-static ReturnCode iso15693PhyVCDCode1Of256(const uint8_t data, uint8_t* outbuffer, uint16_t maxOutBufLen, uint16_t* outBufLen)
+static void iso15693PhyVCDCode1Of256(uint8_t data, uint8_t* outbuf)
 {
-    uint8_t tmp;
-    ReturnCode err = ERR_NONE;
-    uint16_t a;
-    uint8_t* outbuf = outbuffer;
-
-    *outBufLen = 0;
-
-    if (maxOutBufLen < 64U) {
-        return ERR_NOMEM;
-    }
-
-    tmp = data;
-    for (a = 0; a < 64U; a++)
-    {
-        switch (tmp)
-        {
-            case 0:
-                *outbuf = ISO15693_DAT_SLOT0_1_256;
-                break;
-            case 1:
-                *outbuf = ISO15693_DAT_SLOT1_1_256;
-                break;
-            case 2:
-                *outbuf = ISO15693_DAT_SLOT2_1_256;
-                break;
-            case 3:
-                *outbuf = ISO15693_DAT_SLOT3_1_256;
-                break;
-            default:
-                *outbuf = 0;
-                break;               
-        }
-        outbuf++;
-        (*outBufLen)++;
-        tmp -= 4U;
-    }
-
-    return err;
+    ST_MEMSET(outbuf, 0, ISO15693_CODE_1_256_LEN);
+    outbuf[data >> 2U] = (uint8_t)(ISO15693_DAT_SLOT0_1_256 << ((data & 0x3U) * 2U));
 }
 
 #endif /* RFAL_FEATURE_NFCV */
@@ -58,6 +58,15 @@
     #define RFAL_FEATURE_NFCV   false    /* NFC-V module configuration missing. Disabled by default */
 #endif
 
+#ifndef RFAL_NFCV_ADAPTIVE_FWT
+    #define RFAL_NFCV_ADAPTIVE_FWT   false   /* Learn the FWT of each command from the responses seen. Disabled by default */
+#endif
+
+#ifndef platformGetSysTickUs
+    #undef  RFAL_NFCV_ADAPTIVE_FWT
+    #define RFAL_NFCV_ADAPTIVE_FWT   false   /* Response times can only be measured with a us time base */
+#endif
+
 #if RFAL_FEATURE_NFCV
 
 /*
@@ -104,6 +113,23 @@
  *                    - NFC Forum defines FDTV,INVENT_NORES = (4394 + 2048)/fc. Digital 2.0  B.5*/
 #define RFAL_NFCV_FDT_V_INVENT_NORES      4U
 
+/*! FDTV,INVENT_NORES = (4394 + 2048)/fc in us, used instead of the ms value when the platform provides a us delay */
+#define RFAL_NFCV_FDT_V_INVENT_NORES_US   476U
+
+
+/*! Adaptive FWT: the longest response time seen for a command, plus a quarter and RFAL_NFCV_FWT_MARGIN_US,
+ *  replaces the spec maximum once RFAL_NFCV_FWT_LEARN responses were seen. A timeout with the learned FWT
+ *  makes the next request of the command wait the spec maximum again, so a slower tag is learned as well.
+ *  The profiles are learned on one tag only: they are keyed by its IC reference and forgotten as soon as
+ *  an inventory or an addressed request sees another UID */
+#define RFAL_NFCV_FWT_PROFILES            8U     /*!< Commands whose response time is learned                           */
+#define RFAL_NFCV_FWT_LEARN               2U     /*!< Responses seen before the learned FWT is used                     */
+#define RFAL_NFCV_FWT_MARGIN_US           1000U  /*!< Fixed margin added to the longest response time seen              */
+#define RFAL_NFCV_FWT_MEASURE_MS          50U    /*!< Longest exchange measured, the us time base wraps after 65 ms     */
+#define RFAL_NFCV_FWT_NONE                0U     /*!< Profile key of a request whose FWT is not learned                 */
+#define RFAL_NFCV_TX_BYTE_US              302U   /*!< Request byte on air, 1 out of 4 coding                            */
+#define RFAL_NFCV_RX_BYTE_US              302U   /*!< Response byte on air at 26.48 kbps, half of it at 52.97 kbps      */
+
 
 
 /*
@@ -111,10 +137,20 @@
  * GLOBAL MACROS
  ******************************************************************************
  */
+
+#ifdef platformDelayUs
+    #define rfalNfcvInventNoResDelay()    platformDelayUs( RFAL_NFCV_FDT_V_INVENT_NORES_US )   /*!< Wait FDTV,INVENT_NORES between slots */
+#else
+    #define rfalNfcvInventNoResDelay()    platformDelay( RFAL_NFCV_FDT_V_INVENT_NORES )        /*!< Wait FDTV,INVENT_NORES between slots */
+#endif /* platformDelayUs */
+
  
  /*! Checks if a valid INVENTORY_RES is valid    Digital 2.2  9.6.2.1 & 9.6.2.3  */
  #define rfalNfcvCheckInvRes( f, l )     (((l)==rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN)) && ((f)==RFAL_NFCV_RES_FLAG_NOERROR))
 
+/*! Adaptive FWT profile of request flags f, command c writing n blocks. With the Option flag a write is only answered after an EOF, such requests are not learned */
+#define rfalNfcvFwtKey( f, c, n )        ((((f) & (uint8_t)RFAL_NFCV_REQ_FLAG_OPTION) != 0U) ? (uint16_t)RFAL_NFCV_FWT_NONE : (uint16_t)((uint16_t)(c) | (uint16_t)(((uint16_t)(n) & 0xFFU) << 8U)))
+
 
 
 /*
@@ -150,12 +186,25 @@ typedef struct
 }rfalNfcvCollision;
 
 
+/*! Response time learned for one command */
+typedef struct
+{
+    uint16_t key;                                   /*!< Command code, blocks of a Write Multiple in the upper byte */
+    uint16_t icRef;                                 /*!< IC manufacturer and IC reference of the tag it was learned on */
+    uint16_t fdtUs;                                 /*!< Longest response time seen, request and response removed  */
+    uint8_t  seen;                                  /*!< Responses seen, saturates                                 */
+    bool     fallback;                              /*!< Learned FWT timed out, next request waits the spec maximum */
+}rfalNfcvFwtProfile;
+
+
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
 static ReturnCode rfalNfcvParseError( uint8_t err );
+static ReturnCode rfalNfcvTransceive( uint16_t key, const uint8_t *uid, uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, uint32_t fwt );
+static void rfalNfcvFwtTag( const uint8_t *uid );
 
 /*
 ******************************************************************************
@@ -163,6 +212,12 @@ static ReturnCode rfalNfcvParseError( uint8_t err );
 ******************************************************************************
 */
 
+#if RFAL_NFCV_ADAPTIVE_FWT
+static rfalNfcvFwtProfile gNfcvFwt[RFAL_NFCV_FWT_PROFILES];   /*!< Learned response times of the tag in gNfcvFwtUid   */
+static uint8_t            gNfcvFwtNext;                       /*!< Profile replaced by the next new command           */
+static uint8_t            gNfcvFwtUid[RFAL_NFCV_UID_LEN];     /*!< Tag the profiles are learned on                    */
+#endif /* RFAL_NFCV_ADAPTIVE_FWT */
+
 /*
 ******************************************************************************
 * LOCAL FUNCTIONS
@@ -189,6 +244,119 @@ static ReturnCode rfalNfcvParseError( uint8_t err )
     }
 }
 
+/*******************************************************************************/
+static void rfalNfcvFwtTag( const uint8_t *uid )
+{
+#if RFAL_NFCV_ADAPTIVE_FWT
+    /* Another tag starts with no profile, it is not trusted to answer like the last one */
+    if( (uid != NULL) && (ST_BYTECMP( gNfcvFwtUid, uid, RFAL_NFCV_UID_LEN ) != 0) )
+    {
+        ST_MEMSET( gNfcvFwt, 0x00, sizeof(gNfcvFwt) );
+        ST_MEMCPY( gNfcvFwtUid, uid, RFAL_NFCV_UID_LEN );
+        gNfcvFwtNext = 0;
+    }
+#else
+    NO_WARNING( uid );
+#endif /* RFAL_NFCV_ADAPTIVE_FWT */
+}
+
+/*******************************************************************************/
+static ReturnCode rfalNfcvTransceive( uint16_t key, const uint8_t *uid, uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, uint32_t fwt )
+{
+#if RFAL_NFCV_ADAPTIVE_FWT
+    ReturnCode          ret;
+    rfalNfcvFwtProfile *prof;
+    rfalBitRate         rxBR;
+    uint32_t            startMs;
+    uint32_t            airUs;
+    uint32_t            learnedUs;
+    uint16_t            startUs;
+    uint16_t            elapsedUs;
+    uint16_t            icRef;
+    bool                learned;
+    uint8_t             i;
+    
+    /* Addressed requests tell the tag, select mode ones go to the tag last addressed */
+    rfalNfcvFwtTag( uid );
+    
+    if( key == RFAL_NFCV_FWT_NONE )
+    {
+        return rfalTransceiveBlockingTxRx( txBuf, txBufLen, rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, fwt );
+    }
+    
+    /* Find the profile of the command on this IC, a new command replaces the oldest one */
+    icRef = (uint16_t)(((uint16_t)gNfcvFwtUid[RFAL_NFCV_UID_LEN - 2U] << 8U) | gNfcvFwtUid[RFAL_NFCV_UID_LEN - 3U]);
+    prof  = NULL;
+    for( i = 0; i < RFAL_NFCV_FWT_PROFILES; i++ )
+    {
+        if( (gNfcvFwt[i].key == key) && (gNfcvFwt[i].icRef == icRef) )
+        {
+            prof = &gNfcvFwt[i];
+            break;
+        }
+    }
+    if( prof == NULL )
+    {
+        prof         = &gNfcvFwt[gNfcvFwtNext];
+        gNfcvFwtNext = (uint8_t)((gNfcvFwtNext + 1U) % RFAL_NFCV_FWT_PROFILES);
+        ST_MEMSET( prof, 0x00, sizeof(rfalNfcvFwtProfile) );
+        prof->key    = key;
+        prof->icRef  = icRef;
+    }
+    
+    /* Learned FWT, never above the spec maximum */
+    learned = false;
+    if( (prof->seen >= RFAL_NFCV_FWT_LEARN) && (!prof->fallback) )
+    {
+        learnedUs = ((uint32_t)prof->fdtUs + ((uint32_t)prof->fdtUs / 4U) + RFAL_NFCV_FWT_MARGIN_US);
+        if( rfalConvUsTo1fc( learnedUs ) < fwt )
+        {
+            fwt     = rfalConvUsTo1fc( learnedUs );
+            learned = true;
+        }
+    }
+    
+    rfalGetBitRate( NULL, &rxBR );
+    startMs = platformGetSysTick();
+    startUs = platformGetSysTickUs();
+    
+    ret = rfalTransceiveBlockingTxRx( txBuf, txBufLen, rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, fwt );
+    
+    elapsedUs = (uint16_t)(platformGetSysTickUs() - startUs);
+    
+    if( ret == ERR_TIMEOUT )
+    {
+        /* A tag slower than learned gets the spec maximum next, a tag gone leaves the learned FWT in place */
+        prof->fallback = learned;
+        return ret;
+    }
+    prof->fallback = false;
+    
+    if( (ret != ERR_NONE) || ((platformGetSysTick() - startMs) > RFAL_NFCV_FWT_MEASURE_MS) )
+    {
+        return ret;
+    }
+    
+    /* Response time: the exchange without the request and the response on air, both at their shortest */
+    airUs = ((uint32_t)(txBufLen + RFAL_NFCV_CRC_LEN) * RFAL_NFCV_TX_BYTE_US);
+    airUs += (((uint32_t)(*rcvLen) * RFAL_NFCV_RX_BYTE_US) / ((rxBR == RFAL_BR_52p97) ? 2U : 1U));
+    if( elapsedUs > airUs )
+    {
+        prof->fdtUs = MAX( prof->fdtUs, (uint16_t)(elapsedUs - airUs) );
+    }
+    if( prof->seen < 0xFFU )
+    {
+        prof->seen++;
+    }
+    
+    return ret;
+#else
+    NO_WARNING( key );
+    NO_WARNING( uid );
+    return rfalTransceiveBlockingTxRx( txBuf, txBufLen, rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, fwt );
+#endif /* RFAL_NFCV_ADAPTIVE_FWT */
+}
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -263,6 +431,8 @@ ReturnCode rfalNfcvPollerInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, co
         {
             return ERR_PROTO;
         }
+        
+        rfalNfcvFwtTag( invRes->UID );
     }
     
     return ret;
@@ -325,7 +495,7 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
             return ERR_RF_COLLISION;
         }
 
-        platformDelay(RFAL_NFCV_FDT_V_INVENT_NORES);
+        rfalNfcvInventNoResDelay();
 
         /*******************************************************************************/
         /* Collisions pending, Anticollision loop must be executed                     */
@@ -364,7 +534,7 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
             {
                 if( rcvdLen < rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN) )
                 { /* If only a partial frame was received make sure the FDT_V_INVENT_NORES is fulfilled */
-                    platformDelay(RFAL_NFCV_FDT_V_INVENT_NORES);
+                    rfalNfcvInventNoResDelay();
                 }
                 
                 /* Check if response is a correct frame (no TxRx error)  Activity 2.1  9.3.7.11  (Symbol 10)*/
@@ -405,7 +575,7 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
             else 
             { 
                 /* Timeout */
-                platformDelay(RFAL_NFCV_FDT_V_INVENT_NORES);
+                rfalNfcvInventNoResDelay();
             }
             
             /* Check if devices found have reached device limit   Activity 2.1  9.3.7.13  (Symbol 12) */
@@ -594,7 +764,7 @@ ReturnCode rfalNfcvPollerWriteMultipleBlocks( uint8_t flags, const uint8_t* uid,
     }
     
     /* Transceive Command */
-    ret = rfalTransceiveBlockingTxRx( txBuf, msgIt, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCV_FDT_MAX );
+    ret = rfalNfcvTransceive( rfalNfcvFwtKey( flags, RFAL_NFCV_CMD_WRITE_MULTIPLE_BLOCKS, numOfBlocks ), uid, txBuf, msgIt, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_NFCV_FDT_MAX );
 
     if( ret != ERR_NONE )
     {
@@ -736,7 +906,7 @@ ReturnCode rfalNfcvPollerExtendedWriteMultipleBlocks( uint8_t flags, const uint8
     }
     
     /* Transceive Command */
-    ret = rfalTransceiveBlockingTxRx( txBuf, msgIt, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCV_FDT_MAX );
+    ret = rfalNfcvTransceive( rfalNfcvFwtKey( flags, RFAL_NFCV_CMD_EXTENDED_WRITE_MULTIPLE_BLOCK, numOfBlocks ), uid, txBuf, msgIt, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_NFCV_FDT_MAX );
 
     if( ret != ERR_NONE )
     {
@@ -860,8 +1030,8 @@ ReturnCode rfalNfcvPollerTransceiveReq( uint8_t cmd,            // command code
     }
     // END IF
     
-    /* Call Transceive Command to send the payload */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, (RFAL_NFCV_CMD_LEN + RFAL_NFCV_FLAG_LEN +(uint16_t)msgIt), rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCV_FDT_MAX );
+    /* Call Transceive Command to send the payload, with the FWT learned for the command */
+    ret = rfalNfcvTransceive( rfalNfcvFwtKey( flags, cmd, 0U ), uid, (uint8_t*)&req, (RFAL_NFCV_CMD_LEN + RFAL_NFCV_FLAG_LEN +(uint16_t)msgIt), rxBuf, rxBufLen, rcvLen, RFAL_NFCV_FDT_MAX );
     
     /* IF the Option Flag is set in certain commands an EOF needs to be sent after 20ms to retrieve the VICC response      ISO15693-3 2009  10.4.2 & 10.4.3 & 10.4.5 */
     if( ((flags & (uint8_t)RFAL_NFCV_REQ_FLAG_OPTION) != 0U) && ((cmd == (uint8_t)RFAL_NFCV_CMD_WRITE_SINGLE_BLOCK) || (cmd == (uint8_t)RFAL_NFCV_CMD_WRITE_MULTIPLE_BLOCKS)        ||
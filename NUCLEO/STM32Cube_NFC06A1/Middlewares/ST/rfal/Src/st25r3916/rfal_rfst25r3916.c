@@ -289,6 +289,8 @@ typedef union{  /*  PRQA S 0750 # MISRA 19.2 - Both members are of the same type
 #define RFAL_ISO15693_IGNORE_BITS       rfalConvBytesToBits(2U)                       /*!< Ignore collisions before the UID (RES_FLAG + DSFID)                             */
 #define RFAL_ISO15693_INV_RES_LEN       12U                                           /*!< ISO15693 Inventory response length with CRC (bytes)                             */
 #define RFAL_ISO15693_INV_RES_DUR       4U                                            /*!< ISO15693 Inventory response duration @ 26 kbps (ms)                             */
+#define RFAL_ISO15693_BYTE_DUR_US       303U                                          /*!< ISO15693 response byte duration 4096/fc @ 26 kbps (us)                          */
+#define RFAL_ISO15693_EOF_DUR_US        152U                                          /*!< ISO15693 response EOF duration 2048/fc @ 26 kbps (us)                           */
 
 #define RFAL_WU_MIN_WEIGHT_VAL          4U                                            /*!< ST25R3916 minimum Wake-up weight value                                         */
 
@@ -420,6 +422,7 @@ static rfal gRFAL;              /*!< RFAL module instance               */
 ******************************************************************************
 */
 
+static ReturnCode rfalSetModeRegs( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR );
 static void rfalTransceiveTx( void );
 static void rfalTransceiveRx( void );
 static ReturnCode rfalTransceiveRunBlockingTx( void );
@@ -558,8 +561,29 @@ ReturnCode rfalCalibrate( void )
     /* Automatic regulator adjustment only performed if not set manually on Analog Configs */
     if( st25r3916CheckReg( ST25R3916_REG_REGULATOR_CONTROL, ST25R3916_REG_REGULATOR_CONTROL_reg_s, 0x00 ) )
     {
+#if defined(platformRfCalibrationLoad) && defined(platformRfCalibrationStore)
+        uint8_t supply;
+        uint8_t rege;
+        
+        st25r3916ReadRegister( ST25R3916_REG_IO_CONF2, &supply );
+        supply &= ST25R3916_REG_IO_CONF2_sup3V;
+        
+        /* Apply a previously found setting manually instead of executing Adjust Regulators */
+        if( platformRfCalibrationLoad( supply, &rege ) )
+        {
+            st25r3916ChangeRegisterBits( ST25R3916_REG_REGULATOR_CONTROL, (ST25R3916_REG_REGULATOR_CONTROL_reg_s | ST25R3916_REG_REGULATOR_CONTROL_rege_mask),
+                                         (ST25R3916_REG_REGULATOR_CONTROL_reg_s | ((rege << ST25R3916_REG_REGULATOR_CONTROL_rege_shift) & ST25R3916_REG_REGULATOR_CONTROL_rege_mask)) );
+            return ERR_NONE;
+        }
+#endif /* platformRfCalibrationLoad && platformRfCalibrationStore */
+        
         /* Adjust the regulators so that Antenna Calibrate has better Regulator values */
         st25r3916AdjustRegulators( &resValue );
+        
+#if defined(platformRfCalibrationLoad) && defined(platformRfCalibrationStore)
+        st25r3916ReadRegister( ST25R3916_REG_REGULATOR_RESULT, &rege );
+        platformRfCalibrationStore( supply, (uint8_t)((rege & ST25R3916_REG_REGULATOR_RESULT_reg_mask) >> ST25R3916_REG_REGULATOR_RESULT_reg_shift) );
+#endif /* platformRfCalibrationLoad && platformRfCalibrationStore */
     }
     
     return ERR_NONE;
@@ -642,6 +666,25 @@ void rfalDisableObsvMode( void )
 
 /*******************************************************************************/
 ReturnCode rfalSetMode( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR )
+{
+#ifdef ST25R_COM_PROFILE
+    ReturnCode ret;
+    uint8_t    phase;
+    
+    /* Attribute the register writes to the mode change */
+    phase = st25r3916comSetPhase( ST25R3916_COM_PHASE_SET_MODE );
+    ret   = rfalSetModeRegs( mode, txBR, rxBR );
+    st25r3916comSetPhase( phase );
+    
+    return ret;
+#else
+    return rfalSetModeRegs( mode, txBR, rxBR );
+#endif /* ST25R_COM_PROFILE */
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalSetModeRegs( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR )
 {
 
     /* Check if RFAL is not initialized */
@@ -1444,16 +1487,39 @@ ReturnCode rfalTransceiveBlockingRx( void )
 ReturnCode rfalTransceiveBlockingTxRx( uint8_t* txBuf, uint16_t txBufLen, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t* actLen, uint32_t flags, uint32_t fwt )
 {
     ReturnCode ret;
+    uint16_t   rxLen = 0U;
+#ifdef ST25R_COM_PROFILE
+    uint8_t    phase;
     
-    EXIT_ON_ERR( ret, rfalTransceiveBlockingTx( txBuf, txBufLen, rxBuf, rxBufLen, actLen, flags, fwt ) );
-    ret = rfalTransceiveBlockingRx();
+    phase = st25r3916comSetPhase( ST25R3916_COM_PHASE_TRANSCEIVE );
+#endif /* ST25R_COM_PROFILE */
     
-    /* Convert received bits to bytes */
-    if( actLen != NULL )
+#ifdef platformRfTxRxStart
+    platformRfTxRxStart();
+#endif /* platformRfTxRxStart */
+    
+    ret = rfalTransceiveBlockingTx( txBuf, txBufLen, rxBuf, rxBufLen, actLen, flags, fwt );
+    if( ret == ERR_NONE )
     {
-        *actLen = rfalConvBitsToBytes(*actLen);
+        ret = rfalTransceiveBlockingRx();
+        
+        /* Convert received bits to bytes */
+        if( actLen != NULL )
+        {
+            *actLen = rfalConvBitsToBytes(*actLen);
+            rxLen   = *actLen;
+        }
     }
     
+#ifdef platformRfTxRxEnd
+    /* Every result is passed on, a failed Tx included, so each Start has its End */
+    ret = platformRfTxRxEnd( ret, txBuf, txBufLen, rxLen );
+#endif /* platformRfTxRxEnd */
+    
+#ifdef ST25R_COM_PROFILE
+    st25r3916comSetPhase( phase );
+#endif /* ST25R_COM_PROFILE */
+    
     return ret;
 }
 
@@ -2961,7 +3027,11 @@ ReturnCode rfalISO15693TransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txB
     {
         /* If INVENTORY_RES is shorter than expected, tag is still modulating *
          * Ensure that response is complete before next frame                 */
+#ifdef platformDelayUs
+        platformDelayUs( (uint16_t)( ((RFAL_ISO15693_INV_RES_LEN - rfalConvBitsToBytes(*ctx.rxRcvdLen)) * RFAL_ISO15693_BYTE_DUR_US) + RFAL_ISO15693_EOF_DUR_US ) );
+#else
         platformDelay( (uint8_t)( (RFAL_ISO15693_INV_RES_LEN - rfalConvBitsToBytes(*ctx.rxRcvdLen)) / ((RFAL_ISO15693_INV_RES_LEN / RFAL_ISO15693_INV_RES_DUR)+1U) ));
+#endif /* platformDelayUs */
     }
     
     /* Restore common Analog configurations for this mode */
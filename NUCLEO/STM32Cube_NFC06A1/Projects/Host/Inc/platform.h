@@ -0,0 +1,166 @@
+/*********************************************************************************
+* File Name      	 : platform.h
+* Creation Date      : 10/19/2026
+* Description        : Host platform header file. Takes the place of
+* 						Projects/Inc/platform.h when the firmware sources are
+* 						built on Linux by Projects/Host/Makefile. Same RFAL
+* 						features and macros as the board, mapped onto the
+* 						simulated board of sim_hal.h.
+**********************************************************************************/
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+
+#include "st_errno.h"
+#include "sim_hal.h"
+#include "timer.h"
+#include "logger.h"
+#include "fault_inject.h"
+#include "trace.h"
+#include "rf_probe.h"
+#include "boot.h"
+#include "ram_probe.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define ST25R_SS_PIN                 SIM_PIN_SS               /*!< GPIO pin used for ST25R SPI SS                */
+#define ST25R_SS_PORT                SIM_PORT_SPI             /*!< GPIO port used for ST25R SPI SS port          */
+#define ST25R_INT_PIN                SIM_PIN_IRQ              /*!< GPIO pin used for ST25R IRQ                   */
+#define ST25R_INT_PORT               SIM_PORT_SPI             /*!< GPIO port used for ST25R IRQ port             */
+
+#define PLATFORM_LED_FIELD_PIN       SIM_PIN_LED6             /*!< GPIO pin used as field LED  */
+#define PLATFORM_LED_FIELD_PORT      SIM_PORT_LED             /*!< GPIO port used as field LED */
+#define PLATFORM_LED_A_PIN           SIM_PIN_LED3             /*!< GPIO pin used for LED A     */
+#define PLATFORM_LED_A_PORT          SIM_PORT_LED             /*!< GPIO port used for LED A    */
+#define PLATFORM_LED_B_PIN           SIM_PIN_LED2             /*!< GPIO pin used for LED B     */
+#define PLATFORM_LED_B_PORT          SIM_PORT_LED             /*!< GPIO port used for LED B    */
+#define PLATFORM_LED_F_PIN           SIM_PIN_LED1             /*!< GPIO pin used for LED F     */
+#define PLATFORM_LED_F_PORT          SIM_PORT_LED             /*!< GPIO port used for LED F    */
+#define PLATFORM_LED_V_PIN           SIM_PIN_LED4             /*!< GPIO pin used for LED V     */
+#define PLATFORM_LED_V_PORT          SIM_PORT_LED             /*!< GPIO port used for LED V    */
+#define PLATFORM_LED_AP2P_PIN        SIM_PIN_LED5             /*!< GPIO pin used for LED AP2P  */
+#define PLATFORM_LED_AP2P_PORT       SIM_PORT_LED             /*!< GPIO port used for LED AP2P */
+
+/* Exported macro ------------------------------------------------------------*/
+#define platformProtectST25RComm()                do{ globalCommProtectCnt++;                  \
+                                                          simSpend(SIM_HOOK_NS);               \
+                                                        }while(0)                                  /*!< Protect unique access to ST25R communication channel - the simulated IRQ is held while the count is not 0 */
+#define platformUnprotectST25RComm()              do{ globalCommProtectCnt--;             \
+                                                          if (globalCommProtectCnt == 0U) \
+                                                          {                               \
+                                                            simIrqEnable();               \
+                                                          }                               \
+                                                        }while(0)                                  /*!< Unprotect unique access to ST25R communication channel - takes a pending simulated IRQ */
+
+#define platformProtectST25RIrqStatus()             platformProtectST25RComm()                	   /*!< Protect unique access to IRQ status var */
+#define platformUnprotectST25RIrqStatus()           platformUnprotectST25RComm()             	   /*!< Unprotect the IRQ status var            */
+
+#define platformProtectWorker()                                                                    /* Protect RFAL Worker/Task/Process from concurrent execution on multi thread platforms   */
+#define platformUnprotectWorker()                                                                  /* Unprotect RFAL Worker/Task/Process from concurrent execution on multi thread platforms */
+
+#define platformIrqST25RSetCallback( cb )
+#define platformIrqST25RPinInitialize()
+
+#define platformLedsInitialize()                                                                   /*!< Initializes the pins used as LEDs to outputs*/
+
+#define platformLedOff( port, pin )                 platformGpioClear(port, pin)                   /*!< Turns the given LED Off                     */
+#define platformLedOn( port, pin )                  platformGpioSet(port, pin)                     /*!< Turns the given LED On                      */
+#define platformLedToogle( port, pin )              platformGpioToogle(port, pin)                  /*!< Toogle the given LED                        */
+
+#define platformGpioSet( port, pin )                simGpioWrite(port, pin, true)                  /*!< Turns the given GPIO High                   */
+#define platformGpioClear( port, pin )              simGpioWrite(port, pin, false)                 /*!< Turns the given GPIO Low                    */
+#define platformGpioToogle( port, pin )             simGpioToggle(port, pin)                       /*!< Toogles the given GPIO                      */
+#define platformGpioIsHigh( port, pin )             simGpioIsHigh(port, pin)                       /*!< Checks if the given LED is High             */
+#define platformGpioIsLow( port, pin )              (!platformGpioIsHigh(port, pin))               /*!< Checks if the given LED is Low              */
+
+#define platformTimerCreate( t )                    timerCalculateTimer(t)                         /*!< Create a timer with the given time (ms)     */
+#define platformTimerIsExpired( timer )             timerIsExpired(timer)                          /*!< Checks if the given timer is expired        */
+#define platformTimerDestroy( timer )                                                              /*!< Stop and release the given timer            */
+#define platformDelay( t )                          HAL_Delay( t )                                 /*!< Performs a delay for the given time (ms)    */
+#define platformTimerCreateUs( t )                  timerCalculateTimerUs(t)                       /*!< Create a timer with the given time (us), max 32767 us */
+#define platformTimerIsExpiredUs( timer )           timerIsExpiredUs(timer)                        /*!< Checks if the given us timer is expired     */
+#define platformDelayUs( t )                        timerDelayUs( t )                              /*!< Performs a delay for the given time (us), max 32767 us */
+
+#define platformGetSysTick()                        HAL_GetTick()                                  /*!< Get System Tick ( 1 tick = 1 ms)            */
+#define platformGetSysTickUs()                      simGetTickUs()                                 /*!< Get the 16 bit us time base ( 1 tick = 1 us) */
+
+#define platformWaitForInterrupt( cond )            do{ if( cond ) { simSleep(); } }while(0)       /*!< Sleep until the next interrupt if cond still holds. The SysTick wakes the core at least every 1 ms */
+#define platformGetCycleStamp()                     simGetCycleStamp()                             /*!< Core cycles elapsed in the current SysTick period, used to measure latencies below 1 ms */
+#define platformCycleStampPeriod()                  (SIM_CORE_HZ / 1000U)                          /*!< Core cycles in one SysTick period           */
+
+#define platformRfTxRxStart()                       traceRfStart()                                 /*!< Called before each blocking RF transceive   */
+#define platformRfTxRxEnd( ret, txBuf, txLen, rxLen ) traceRfEnd( (ret), (txBuf), (txLen), (rxLen) ) /*!< Called with the result of each blocking RF transceive, returns the result to use (fault injection on Debug builds) */
+#if RF_PROBE
+#define ST25R_COM_PROFILE                                                                          /*!< Count the ST25R3916 SPI traffic per phase, reported with the RF probe */
+#endif
+
+#define platformErrorHandle()                       simErrorHandle(__FILE__,__LINE__)              /*!< Global error handler or trap                */
+
+#define platformSpiSelect()                         platformGpioClear(ST25R_SS_PORT, ST25R_SS_PIN) /*!< SPI SS\CS: Chip|Slave Select                */
+#define platformSpiDeselect()                       platformGpioSet(ST25R_SS_PORT, ST25R_SS_PIN)   /*!< SPI SS\CS: Chip|Slave Deselect              */
+#define platformSpiTxRx( txBuf, rxBuf, len )        simSpiTxRx(txBuf, rxBuf, len)                  /*!< SPI transceive                              */
+
+#define platformLog(...)                            logUsart(__VA_ARGS__)                           /*!< Log  method                                 */
+
+/*
+******************************************************************************
+* GLOBAL VARIABLES
+******************************************************************************
+*/
+extern uint8_t globalCommProtectCnt;                      /* Global Protection Counter provided per platform - instantiated in sim_main.c */
+
+/*
+******************************************************************************
+* RFAL FEATURES CONFIGURATION
+******************************************************************************
+*/
+
+#define RFAL_FEATURE_LISTEN_MODE               false       /*!< Enable/Disable RFAL support for Listen Mode                              */
+#define RFAL_FEATURE_WAKEUP_MODE               false       /*!< Enable/Disable RFAL support for the Wake-Up mode                         */
+#define RFAL_FEATURE_NFCA                      false       /*!< Enable/Disable RFAL support for NFC-A (ISO14443A)                        */
+#define RFAL_FEATURE_NFCB                      true       /*!< Enable/Disable RFAL support for NFC-B (ISO14443B)                         */
+#define RFAL_FEATURE_NFCF                      false       /*!< Enable/Disable RFAL support for NFC-F (FeliCa)                           */
+#define RFAL_FEATURE_NFCV                      true       /*!< Enable/Disable RFAL support for NFC-V (ISO15693)                          */
+#define RFAL_FEATURE_T1T                       false       /*!< Enable/Disable RFAL support for T1T (Topaz)                              */
+#define RFAL_FEATURE_T2T                       false       /*!< Enable/Disable RFAL support for T2T (Mifare)                             */
+#define RFAL_FEATURE_T4T                       false       /*!< Enable/Disable RFAL support for T4T                                      */
+#define RFAL_FEATURE_ST25TB                    true       /*!< Enable/Disable RFAL support for ST25TB                                    */
+#define RFAL_FEATURE_ST25xV                    true       /*!< Enable/Disable RFAL support for  ST25TV/ST25DV                            */
+#define RFAL_FEATURE_DYNAMIC_ANALOG_CONFIG     false      /*!< Enable/Disable Analog Configs to be dynamically updated (RAM)             */
+#define RFAL_FEATURE_DPO                       false      /*!< Enable/Disable RFAL dynamic power support                                 */
+#define RFAL_FEATURE_ISO_DEP                   false       /*!< Enable/Disable RFAL support for ISO-DEP (ISO14443-4)                     */
+#define RFAL_FEATURE_ISO_DEP_POLL              false       /*!< Enable/Disable RFAL support for Poller mode (PCD) ISO-DEP (ISO14443-4)   */
+#define RFAL_FEATURE_ISO_DEP_LISTEN            false       /*!< Enable/Disable RFAL support for Listen mode (PICC) ISO-DEP (ISO14443-4)  */
+#define RFAL_FEATURE_NFC_DEP                   false       /*!< Enable/Disable RFAL support for NFC-DEP (NFCIP1/P2P)                     */
+
+#define RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN    256U       /*!< ISO-DEP I-Block max length. Please use values as defined by rfalIsoDepFSx */
+#define RFAL_FEATURE_NFC_DEP_BLOCK_MAX_LEN     254U       /*!< NFC-DEP Block/Payload length. Allowed values: 64, 128, 192, 254           */
+#define RFAL_FEATURE_NFC_RF_BUF_LEN            258U       /*!< RF buffer length used by RFAL NFC layer                                   */
+
+#define RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN      512U       /*!< ISO-DEP APDU max length. Please use multiples of I-Block max length       */
+#define RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN       512U       /*!< NFC-DEP PDU max length.                                                   */
+
+/*
+******************************************************************************
+* RFAL CUSTOM SETTINGS
+******************************************************************************
+*/
+#define RFAL_ANALOG_CONFIG_CUSTOM                         /*!< Use Custom Analog Configs when defined                                    */
+#define RFAL_NFCV_ADAPTIVE_FWT                 true       /*!< Learn the NFC-V FWT of each command from the responses of the tag in the field */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLATFORM_H */
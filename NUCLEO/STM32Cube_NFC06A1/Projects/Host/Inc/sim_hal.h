@@ -0,0 +1,286 @@
+/********************************************************************************
+* File Name :	sim_hal.h
+* Description: Host board declaration file
+*		          Stands in for the NUCLEO-L053R8 and its HAL when the
+*		          firmware runs on Linux: a simulated time base, the
+*		          SysTick, the GPIOs, the SPI bus to the ST25R3916 model,
+*		          the ST25R3916 interrupt line and the logger UART. Time
+*		          only moves when the firmware spends it: every HAL call
+*		          costs the time it takes on the board, sleeps and delays
+*		          jump to the next event. Interrupts are delivered from
+*		          there, so the firmware runs unmodified.
+*
+*******************************************************************************/
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef SIM_HAL_H	/* Define to prevent recursive inclusion */
+#define SIM_HAL_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SIM_PORT_SPI         ((void *)1)    // ST25R3916 chip select and interrupt line
+#define SIM_PORT_LED         ((void *)2)    // X-NUCLEO-NFC06A1 LEDs
+#define SIM_PIN_SS           0x0001U        // ST25R3916 SPI chip select
+#define SIM_PIN_IRQ          0x0002U        // ST25R3916 interrupt line
+#define SIM_PIN_LED1         0x0001U        // LED F
+#define SIM_PIN_LED2         0x0002U        // LED B
+#define SIM_PIN_LED3         0x0004U        // LED A
+#define SIM_PIN_LED4         0x0008U        // LED V
+#define SIM_PIN_LED5         0x0010U        // LED AP2P
+#define SIM_PIN_LED6         0x0020U        // field LED
+
+#define SIM_NS_MS            1000000ULL     // ns in one SysTick period
+#define SIM_CORE_HZ          32000000U      // core clock, counted by platformGetCycleStamp
+#define SystemCoreClock      SIM_CORE_HZ    // CMSIS core clock, read by codec_bench.c
+#define SIM_HOOK_NS          500U           // firmware time between two HAL calls
+#define SIM_TICK_NS          2000U          // reading the SysTick and the timer that tests it
+#define SIM_SPI_CALL_NS      4000U          // setting up one SPI transfer
+#define SIM_SPI_BYTE_NS      2000U          // one SPI byte at 4 MHz
+
+// HAL UART subset used by logger.c
+#define HAL_UART_MODULE_ENABLED
+#define USART2                       ((void *)2)
+#define UART_WORDLENGTH_8B           0x00000000U
+#define UART_STOPBITS_1              0x00000000U
+#define UART_PARITY_NONE             0x00000000U
+#define UART_MODE_TX_RX              0x0000000CU
+#define UART_HWCONTROL_NONE          0x00000000U
+#define UART_OVERSAMPLING_16         0x00000000U
+#define UART_ONE_BIT_SAMPLE_DISABLE  0x00000000U
+#define UART_ADVFEATURE_NO_INIT      0x00000000U
+
+typedef enum
+{
+	HAL_OK      = 0x00U,
+	HAL_ERROR   = 0x01U,
+	HAL_BUSY    = 0x02U,
+	HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef struct
+{
+	uint32_t BaudRate;
+	uint32_t WordLength;
+	uint32_t StopBits;
+	uint32_t Parity;
+	uint32_t Mode;
+	uint32_t HwFlowCtl;
+	uint32_t OverSampling;
+	uint32_t OneBitSampling;
+} UART_InitTypeDef;
+
+typedef struct
+{
+	uint32_t AdvFeatureInit;
+} UART_AdvFeatureInitTypeDef;
+
+typedef struct
+{
+	void                       *Instance;
+	UART_InitTypeDef           Init;
+	UART_AdvFeatureInitTypeDef AdvancedInit;
+	uint8_t                    *pRxBuffPtr;     // buffer of the pending HAL_UART_Receive_IT, NULL if none
+} UART_HandleTypeDef;
+
+
+
+
+
+/* ------------------------- Exported Function Prototypes ------------------------- */
+
+/****************************************************************************
+* Function Name    : simInit
+* Date             : 10/19/2026
+* Description      : Starts the board at time 0 with the ST25R3916 powered
+* 						and its chip select high.
+*
+* Input Parameters : realTime, true to keep the simulated time behind the
+* 						wall clock, for a terminal user
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simInit(bool realTime);
+
+/****************************************************************************
+* Function Name    : simNow
+* Date             : 10/19/2026
+* Description      : Simulated time since simInit.
+*
+* Input Parameters : none
+*
+* Return		   : time in ns
+*
+*****************************************************************************/
+extern uint64_t simNow(void);
+
+/****************************************************************************
+* Function Name    : simSpend
+* Date             : 10/19/2026
+* Description      : Lets the firmware spend time. The chip events falling
+* 						in it run, and the pending interrupts are taken once
+* 						it is over.
+*
+* Input Parameters : ns, time spent
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simSpend(uint32_t ns);
+
+/****************************************************************************
+* Function Name    : simSleep
+* Date             : 10/19/2026
+* Description      : WFI: jumps to the next interrupt, the next SysTick at
+* 						the latest.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simSleep(void);
+
+/****************************************************************************
+* Function Name    : simIrqEnable
+* Date             : 10/19/2026
+* Description      : NVIC_EnableIRQ of the ST25R3916 line: takes the
+* 						interrupt at once if the line is high.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simIrqEnable(void);
+
+/****************************************************************************
+* Function Name    : HAL_GetTick / HAL_Delay
+* Date             : 10/19/2026
+* Description      : SysTick count in ms, and the blocking delay built on
+* 						it. The delay lasts at least the given time, as on
+* 						the board.
+*
+*****************************************************************************/
+extern uint32_t HAL_GetTick(void);
+extern void HAL_Delay(uint32_t Delay);
+
+/****************************************************************************
+* Function Name    : simGetTickUs / simGetCycleStamp
+* Date             : 10/19/2026
+* Description      : 16 bit us time base, and the core cycles elapsed in the
+* 						current SysTick period.
+*
+*****************************************************************************/
+extern uint16_t simGetTickUs(void);
+extern uint32_t simGetCycleStamp(void);
+
+/****************************************************************************
+* Function Name    : simGpioWrite / simGpioToggle / simGpioIsHigh
+* Date             : 10/19/2026
+* Description      : GPIO access. The chip select goes to the ST25R3916
+* 						model, the interrupt line comes from it.
+*
+*****************************************************************************/
+extern void simGpioWrite(void *port, uint16_t pin, bool high);
+extern void simGpioToggle(void *port, uint16_t pin);
+extern bool simGpioIsHigh(void *port, uint16_t pin);
+
+/****************************************************************************
+* Function Name    : simSpiTxRx
+* Date             : 10/19/2026
+* Description      : Full duplex SPI transfer with the ST25R3916 model,
+* 						timed as on the 4 MHz bus.
+*
+* Input Parameters : txBuf, bytes sent, NULL to send 0x00
+* 					 rxBuf, bytes received, NULL to drop them
+* 					 len, bytes transferred
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simSpiTxRx(const uint8_t *txBuf, uint8_t *rxBuf, uint16_t len);
+
+/****************************************************************************
+* Function Name    : simErrorHandle
+* Date             : 10/19/2026
+* Description      : _Error_Handler of the board: reports where and stops.
+*
+*****************************************************************************/
+extern void simErrorHandle(const char *file, int line);
+
+/****************************************************************************
+* Function Name    : HAL_UART_Init / HAL_UART_Transmit / HAL_UART_Receive_IT
+* Date             : 10/19/2026
+* Description      : Logger UART. Sent bytes go to stdout and take their
+* 						time on the line. A byte queued with simUartFeed
+* 						completes the pending Receive_IT and calls
+* 						HAL_UART_RxCpltCallback once it has been on the
+* 						line.
+*
+*****************************************************************************/
+extern HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+extern HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+extern HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+
+/****************************************************************************
+* Function Name    : simUartFeed
+* Date             : 10/19/2026
+* Description      : Queues a byte on the UART RX line, it arrives one
+* 						character time after the previous one.
+*
+* Input Parameters : byte, byte sent by the UTF
+*
+* Return		   : false if the queue is full
+*
+*****************************************************************************/
+extern bool simUartFeed(uint8_t byte);
+
+/****************************************************************************
+* Function Name    : simUartRxIdle
+* Date             : 10/19/2026
+* Description      : Tells whether every queued byte has been received.
+*
+* Input Parameters : none
+*
+* Return		   : true if the RX line is idle
+*
+*****************************************************************************/
+extern bool simUartRxIdle(void);
+
+/****************************************************************************
+* Function Name    : simUartLastActivity
+* Date             : 10/19/2026
+* Description      : Time the UART last sent or received a byte.
+*
+* Input Parameters : none
+*
+* Return		   : time in ns
+*
+*****************************************************************************/
+extern uint64_t simUartLastActivity(void);
+
+/****************************************************************************
+* Function Name    : simUartSetLineHook
+* Date             : 10/19/2026
+* Description      : Sets the function told about every line the firmware
+* 						sends, without its end of line.
+*
+* Input Parameters : hook, function called, NULL for none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simUartSetLineHook(void (*hook)(const char *line));
+
+#ifdef __cplusplus				// IF we are using C++
+}
+#endif							// END IF
+
+#endif /* SIM_HAL_H */
@@ -0,0 +1,109 @@
+/********************************************************************************
+* File Name :	sim_st25dv.h
+* Description: ST25DV04K model declaration file
+*		          The units in the field of the reader: ST25DV04K tags
+*		          answering the ISO15693 and ST custom commands the
+*		          firmware sends, with their EEPROM, RF passwords and
+*		          sessions, the RFA1SS area protection, the fast transfer
+*		          mailbox and the time each command takes, EEPROM writes
+*		          included. A unit can carry an ICM that takes the
+*		          mailbox message and stores it as its recipe. Turning
+*		          the field off resets the RF state of every tag.
+*
+*******************************************************************************/
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef SIM_ST25DV_H	/* Define to prevent recursive inclusion */
+#define SIM_ST25DV_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SIM_TAG_MAX          8U         // units in the field at once
+#define SIM_TAG_REPLY_LEN    280U       // longest response, flags and CRC included
+
+#define SIM_TAG_ICM          0x01U      // the unit has an ICM reading the mailbox, MB_MODE allowed
+#define SIM_TAG_CONFIGURED   0x02U      // the unit left a previous station with area 1 protected
+
+// Response of one tag to a request
+typedef struct
+{
+	uint8_t  data[SIM_TAG_REPLY_LEN];   // flags, parameters and CRC
+	uint16_t len;                       // bytes in data
+	uint32_t delayNs;                   // end of the request to start of the response
+	bool     fast;                      // sent at the double data rate of the ST fast commands
+} SimTagReply;
+
+
+
+
+
+/* ------------------------- Exported Function Prototypes ------------------------- */
+
+/****************************************************************************
+* Function Name    : simTagsPlace
+* Date             : 10/19/2026
+* Description      : Takes the units off the fixture and places new ones,
+* 						in their factory state unless told otherwise. Each
+* 						unit gets the next serial number of the run.
+*
+* Input Parameters : count, units placed, 0 to SIM_TAG_MAX
+* 					 options, SIM_TAG_xxx
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simTagsPlace(uint8_t count, uint8_t options);
+
+/****************************************************************************
+* Function Name    : simTagsField
+* Date             : 10/19/2026
+* Description      : Tells the tags the reader field went on or off.
+*
+* Input Parameters : on, true while the field is on
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simTagsField(bool on);
+
+/****************************************************************************
+* Function Name    : simTagsRequest
+* Date             : 10/19/2026
+* Description      : Hands a request received by the tags to each of them.
+*
+* Input Parameters : frame, request bytes, CRC included
+* 					 len, bytes in frame, 0 for an EOF alone (next slot of
+* 						an inventory)
+* 					 replies, responses of the tags, SIM_TAG_MAX entries
+*
+* Return		   : number of tags answering
+*
+*****************************************************************************/
+extern uint8_t simTagsRequest(const uint8_t *frame, uint16_t len, SimTagReply *replies);
+
+/****************************************************************************
+* Function Name    : simTagsRead
+* Date             : 10/19/2026
+* Description      : Reads the EEPROM of a unit in the field, for checks.
+*
+* Input Parameters : tag, unit index
+* 					 block, first block
+* 					 data, filled in
+* 					 len, bytes read
+*
+* Return		   : false if there is no such unit
+*
+*****************************************************************************/
+extern bool simTagsRead(uint8_t tag, uint16_t block, uint8_t *data, uint16_t len);
+
+#ifdef __cplusplus				// IF we are using C++
+}
+#endif							// END IF
+
+#endif /* SIM_ST25DV_H */
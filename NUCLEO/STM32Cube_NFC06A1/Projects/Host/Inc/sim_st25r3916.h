@@ -0,0 +1,138 @@
+/********************************************************************************
+* File Name :	sim_st25r3916.h
+* Description: ST25R3916 model declaration file
+*		          Behavioral model of the reader chip on the SPI bus: the
+*		          register spaces, the FIFO, the interrupt registers and
+*		          line, the direct commands the firmware uses, the timers
+*		          (GPT, NRT) and the NFC-V stream mode. A transmitted
+*		          frame is decoded from its 1 of 4 or 1 of 256 coding and
+*		          handed to the tags in the field; their responses are
+*		          coded into the subcarrier stream the chip puts into the
+*		          FIFO, ORed together so two tags answering collide as on
+*		          air. Frames of the other technologies get no answer.
+*
+*******************************************************************************/
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef SIM_ST25R3916_H	/* Define to prevent recursive inclusion */
+#define SIM_ST25R3916_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SIM_CHIP_NO_EVENT    UINT64_MAX     // simChipNextEvent with no event pending
+
+// RF traffic since simChipInit
+typedef struct
+{
+	uint32_t frames;        // frames transmitted
+	uint32_t answered;      // frames at least one tag answered
+	uint32_t txBytes;       // request bytes on air, CRC included
+	uint32_t rxBytes;       // response bytes on air, CRC included
+	uint64_t airNs;         // time the reader or a tag was modulating
+} SimChipStats;
+
+
+
+
+
+/* ------------------------- Exported Function Prototypes ------------------------- */
+
+/****************************************************************************
+* Function Name    : simChipInit
+* Date             : 10/19/2026
+* Description      : Powers the chip up in its default state.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simChipInit(void);
+
+/****************************************************************************
+* Function Name    : simChipSelect
+* Date             : 10/19/2026
+* Description      : Chip select: a falling edge starts an SPI transaction,
+* 						a rising edge ends it.
+*
+* Input Parameters : active, true while the chip select is low
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simChipSelect(bool active);
+
+/****************************************************************************
+* Function Name    : simChipSpi
+* Date             : 10/19/2026
+* Description      : Clocks bytes through the SPI of the chip.
+*
+* Input Parameters : tx, bytes into MOSI
+* 					 rx, bytes out of MISO
+* 					 len, bytes clocked
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simChipSpi(const uint8_t *tx, uint8_t *rx, uint16_t len);
+
+/****************************************************************************
+* Function Name    : simChipIrq
+* Date             : 10/19/2026
+* Description      : Level of the interrupt line: high while an interrupt
+* 						not masked is pending.
+*
+* Input Parameters : none
+*
+* Return		   : true if the line is high
+*
+*****************************************************************************/
+extern bool simChipIrq(void);
+
+/****************************************************************************
+* Function Name    : simChipNextEvent
+* Date             : 10/19/2026
+* Description      : Time of the next thing the chip does on its own.
+*
+* Input Parameters : none
+*
+* Return		   : time in ns, SIM_CHIP_NO_EVENT if none is pending
+*
+*****************************************************************************/
+extern uint64_t simChipNextEvent(void);
+
+/****************************************************************************
+* Function Name    : simChipRun
+* Date             : 10/19/2026
+* Description      : Runs the events due by the given time, in order.
+*
+* Input Parameters : now, current time in ns
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simChipRun(uint64_t now);
+
+/****************************************************************************
+* Function Name    : simChipGetStats
+* Date             : 10/19/2026
+* Description      : RF traffic since simChipInit.
+*
+* Input Parameters : stats, filled in
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void simChipGetStats(SimChipStats *stats);
+
+#ifdef __cplusplus				// IF we are using C++
+}
+#endif							// END IF
+
+#endif /* SIM_ST25R3916_H */
@@ -0,0 +1,541 @@
+/*********************************************************************************
+* File Name :	codec_test.c
+* Description: ISO15693 codec host test implementation file
+*		          Checks rfalCrcCalculateCcitt, iso15693VCDCode and
+*		          iso15693VICCDecode against golden vectors, then times
+*		          them on frames the size of the ones used while
+*		          programming a unit. The golden vectors are the outputs
+*		          of the original ST codec, so a change to the codec that
+*		          alters a single coded bit fails here before it reaches
+*		          the board. Built and run with 'make test' in
+*		          Projects/Host; the exit status is the number of failed
+*		          checks.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "utils.h"
+#include "rfal_crc.h"
+#include "rfal_iso15693_2.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define TEST_BENCH_NS        200000000ULL   // time spent on each benchmark
+#define TEST_TX_LEN          44U            // addressed Write Multiple Blocks of 8 blocks
+#define TEST_RX_LEN          131U           // Read Multiple Blocks response of 32 blocks, flags and CRC
+#define TEST_STREAM_LEN      ((TEST_RX_LEN * 2U) + 3U)
+#define TEST_COL_BIT         20U            // response bit turned into a collision
+#define TEST_CRC_BIT         33U            // response bit inverted to break the CRC
+
+
+
+
+
+/* ------------------------- Golden Vectors ------------------------- */
+// CRC of the ASCII string "123456789", ISO15693 preset, not inverted
+static const uint8_t  goldCrcInput[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+#define GOLD_CRC_CHECK       0x6F91U
+#define GOLD_CRC_RESIDUE     0xF0B8U        // CRC over a frame followed by its inverted CRC
+
+// Inventory request, one slot, no mask, 1 out of 4
+static const uint8_t  goldInvReq[] = { 0x26, 0x01, 0x00 };
+static const uint8_t  goldInvCoded[] =
+{
+	0x21, 0x20, 0x08, 0x20, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x20, 0x08, 0x80, 0x80, 0x20, 0x20, 0x02, 0x02, 0x04
+};
+
+// Addressed Read Single Block of block 56, 1 out of 4
+static const uint8_t  goldReadReq[] = { 0x22, 0x20, 0x11, 0x22, 0x33, 0x44, 0x55, 0x26, 0x02, 0xE0, 0x38 };
+static const uint8_t  goldReadCoded[] =
+{
+	0x21, 0x20, 0x02, 0x20, 0x02, 0x02, 0x02, 0x20, 0x02, 0x08, 0x02, 0x08,
+	0x02, 0x20, 0x02, 0x20, 0x02, 0x80, 0x02, 0x80, 0x02, 0x02, 0x08, 0x02,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x20, 0x08, 0x20, 0x02, 0x20, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x20, 0x80, 0x02, 0x20, 0x80, 0x02, 0x80, 0x02, 0x80,
+	0x08, 0x80, 0x80, 0x80, 0x80, 0x04
+};
+
+// Inventory request with the two subcarriers flag, 1 out of 256: the flag is
+// cleared, then each byte is one pulse in a 64 byte slot frame
+static const uint8_t  goldInv256Req[] = { 0x27, 0x01, 0x00 };
+#define GOLD_INV256_FLAGS    0x26U
+#define GOLD_INV256_LEN      322U
+static const uint16_t goldInv256Pos[] = { 0, 10, 65, 129, 254, 259, 321 };
+static const uint8_t  goldInv256Val[] = { 0x81, 0x20, 0x08, 0x02, 0x20, 0x20, 0x04 };
+
+// Inventory response, flags, DSFID, UID and CRC, as the ST25R3916 reports it in stream mode
+static const uint8_t  goldInvRes[] = { 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x26, 0x02, 0xE0, 0x05, 0x70 };
+static const uint8_t  goldInvResStream[] =
+{
+	0xB7, 0xAA, 0xAA, 0xAA, 0xCA, 0xCA, 0x2A, 0x2B, 0x4B, 0x4B, 0xAB, 0xAC,
+	0xCC, 0xCC, 0x2C, 0x2D, 0x2B, 0xAB, 0xAA, 0x2A, 0xD5, 0xAC, 0xAA, 0x4A,
+	0xAD, 0x03
+};
+
+// Same response with a collision on TEST_COL_BIT
+static const uint8_t  goldColDecoded[] = { 0x00, 0x00, 0x01 };
+#define GOLD_COL_BITS        20U
+// and with the collision ignored up to bit 24, the bit is left 0 and the CRC fails
+static const uint8_t  goldColIgnored[] = { 0x00, 0x00, 0x01, 0x22, 0x33, 0x44, 0x55, 0x26, 0x02, 0xE0, 0x05, 0x70 };
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static uint32_t testFailures;                    // failed checks
+static uint8_t  testFrame[TEST_RX_LEN];          // plain frame
+static uint8_t  testStream[TEST_STREAM_LEN];     // coded request or manchester response
+static uint8_t  testOut[400];                    // coder or decoder output
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static void     testCheck( const char *name, bool pass );
+static void     testSetVcdCoding( iso15693VcdCoding_t coding );
+static void     testPutBits( uint8_t *stream, uint16_t *bitPos, uint8_t bits, uint8_t count );
+static uint16_t testBuildStream( const uint8_t *frame, uint16_t frameLen );
+static void     testSetPair( uint8_t *stream, uint16_t bit, uint8_t pair );
+static uint64_t testNowNs( void );
+static void     testGolden( void );
+static void     testBench( void );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : main
+* Date             : 10/19/2026
+* Description      : Runs the golden vector checks, then the benchmarks.
+*
+* Input Parameters : none
+*
+* Return		   : number of failed checks
+*
+*****************************************************************************/
+
+// BEGIN main
+int main(void)
+{
+	testGolden();
+	testBench();
+
+	printf("Codec test %s, %u failure(s)\n", ((testFailures == 0U) ? "PASS" : "FAIL"), (unsigned)testFailures);
+
+	return (int)testFailures;
+}
+// END main
+
+
+
+
+
+/****************************************************************************
+* Function Name    : testGolden
+* Date             : 10/19/2026
+* Description      : Checks the CRC, the 1 out of 4 and 1 out of 256 coders,
+* 						coding split over several calls and the decoder with
+* 						a clean, a corrupted and a colliding response.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN testGolden
+static void testGolden(void)
+{
+	ReturnCode err;
+	uint16_t   subbitLen;
+	uint16_t   offset;
+	uint16_t   outLen;
+	uint16_t   total;
+	uint16_t   decodedLen;
+	uint16_t   bitsBeforeCol;
+	uint16_t   i;
+	bool       pass;
+
+	/* ---- CRC ---- */
+	testCheck("CRC check value", (rfalCrcCalculateCcitt(0xFFFFU, goldCrcInput, sizeof(goldCrcInput)) == GOLD_CRC_CHECK));
+	testCheck("CRC residue", (rfalCrcCalculateCcitt(0xFFFFU, goldInvRes, sizeof(goldInvRes)) == GOLD_CRC_RESIDUE));
+
+	/* ---- VCD 1 out of 4 ---- */
+	testSetVcdCoding(ISO15693_VCD_CODING_1_4);
+
+	ST_MEMCPY(testFrame, goldInvReq, sizeof(goldInvReq));
+	offset = 0;
+	err = iso15693VCDCode(testFrame, sizeof(goldInvReq), true, true, false, &subbitLen, &offset, testOut, sizeof(testOut), &outLen);
+	testCheck("VCD 1of4 inventory", ( (err == ERR_NONE) && (outLen == sizeof(goldInvCoded)) && (subbitLen == sizeof(goldInvCoded))
+	                               && (memcmp(testOut, goldInvCoded, sizeof(goldInvCoded)) == 0) ));
+
+	ST_MEMCPY(testFrame, goldReadReq, sizeof(goldReadReq));
+	offset = 0;
+	err = iso15693VCDCode(testFrame, sizeof(goldReadReq), true, true, false, &subbitLen, &offset, testOut, sizeof(testOut), &outLen);
+	testCheck("VCD 1of4 read single block", ( (err == ERR_NONE) && (outLen == sizeof(goldReadCoded))
+	                                       && (memcmp(testOut, goldReadCoded, sizeof(goldReadCoded)) == 0) ));
+
+	// Output buffer of the size the RF layer refills the FIFO with: SOF and two bytes, then two bytes per call
+	ST_MEMCPY(testFrame, goldReadReq, sizeof(goldReadReq));
+	offset = 0;
+	total  = 0;
+	do
+	{
+		err = iso15693VCDCode(testFrame, sizeof(goldReadReq), true, true, false, &subbitLen, &offset, &testOut[total], 9U, &outLen);
+		total += outLen;
+	}
+	while ((err == ERR_AGAIN) && (total < (sizeof(testOut) - 9U)));
+	testCheck("VCD 1of4 split coding", ( (err == ERR_NONE) && (total == sizeof(goldReadCoded))
+	                                  && (memcmp(testOut, goldReadCoded, sizeof(goldReadCoded)) == 0) ));
+
+	offset = 0;
+	err = iso15693VCDCode(testFrame, sizeof(goldReadReq), true, true, false, &subbitLen, &offset, testOut, 3U, &outLen);
+	testCheck("VCD 1of4 buffer too small", (err == ERR_NOMEM));
+
+	/* ---- VCD 1 out of 256 ---- */
+	testSetVcdCoding(ISO15693_VCD_CODING_1_256);
+
+	ST_MEMCPY(testFrame, goldInv256Req, sizeof(goldInv256Req));
+	ST_MEMSET(testOut, 0xA5, sizeof(testOut));
+	offset = 0;
+	err = iso15693VCDCode(testFrame, sizeof(goldInv256Req), true, true, false, &subbitLen, &offset, testOut, sizeof(testOut), &outLen);
+	pass = ((err == ERR_NONE) && (outLen == GOLD_INV256_LEN) && (testFrame[0] == GOLD_INV256_FLAGS));
+	for (i = 0; pass && (i < outLen); i++)
+	{
+		uint8_t expected = 0;
+		uint8_t j;
+
+		for (j = 0; j < SIZEOF_ARRAY(goldInv256Pos); j++)
+		{
+			if (goldInv256Pos[j] == i)
+			{
+				expected = goldInv256Val[j];
+			}
+		}
+		pass = (testOut[i] == expected);
+	}
+	testCheck("VCD 1of256 inventory", pass);
+
+	testSetVcdCoding(ISO15693_VCD_CODING_1_4);
+
+	/* ---- VICC decoding ---- */
+	err = iso15693VICCDecode(goldInvResStream, sizeof(goldInvResStream), testOut, sizeof(testOut), &decodedLen, &bitsBeforeCol, 0, false);
+	testCheck("VICC inventory response", ( (err == ERR_NONE) && (decodedLen == sizeof(goldInvRes)) && (bitsBeforeCol == (sizeof(goldInvRes) * 8U))
+	                                    && (memcmp(testOut, goldInvRes, sizeof(goldInvRes)) == 0) ));
+
+	ST_MEMCPY(testStream, goldInvResStream, sizeof(goldInvResStream));
+	testSetPair(testStream, TEST_CRC_BIT, (((goldInvRes[TEST_CRC_BIT / 8U] >> (TEST_CRC_BIT % 8U)) & 0x01U) != 0U) ? 0x01U : 0x02U);
+	err = iso15693VICCDecode(testStream, sizeof(goldInvResStream), testOut, sizeof(testOut), &decodedLen, &bitsBeforeCol, 0, false);
+	testCheck("VICC CRC error", ((err == ERR_CRC) && (decodedLen == sizeof(goldInvRes))));
+
+	ST_MEMCPY(testStream, goldInvResStream, sizeof(goldInvResStream));
+	testSetPair(testStream, TEST_COL_BIT, 0x00U);
+	err = iso15693VICCDecode(testStream, sizeof(goldInvResStream), testOut, sizeof(testOut), &decodedLen, &bitsBeforeCol, 0, false);
+	testCheck("VICC collision", ( (err == ERR_RF_COLLISION) && (bitsBeforeCol == GOLD_COL_BITS)
+	                           && (memcmp(testOut, goldColDecoded, sizeof(goldColDecoded)) == 0) ));
+
+	err = iso15693VICCDecode(testStream, sizeof(goldInvResStream), testOut, sizeof(testOut), &decodedLen, &bitsBeforeCol, 24U, false);
+	testCheck("VICC collision ignored", ( (err == ERR_CRC) && (decodedLen == sizeof(goldColIgnored))
+	                                   && (memcmp(testOut, goldColIgnored, sizeof(goldColIgnored)) == 0) ));
+
+	testStream[0] = 0x15;
+	err = iso15693VICCDecode(testStream, sizeof(goldInvResStream), testOut, sizeof(testOut), &decodedLen, &bitsBeforeCol, 0, false);
+	testCheck("VICC bad SOF", (err == ERR_FRAMING));
+
+	// Round trip of a full size response built by the test itself
+	testFrame[0] = 0x00;
+	for (i = 1; i < (TEST_RX_LEN - 2U); i++)
+	{
+		testFrame[i] = (uint8_t)(i * 7U);
+	}
+	subbitLen = (uint16_t)~rfalCrcCalculateCcitt(0xFFFFU, testFrame, (uint16_t)(TEST_RX_LEN - 2U));
+	testFrame[TEST_RX_LEN - 2U] = (uint8_t)(subbitLen & 0xFFU);
+	testFrame[TEST_RX_LEN - 1U] = (uint8_t)(subbitLen >> 8U);
+	outLen = testBuildStream(testFrame, TEST_RX_LEN);
+	err = iso15693VICCDecode(testStream, outLen, testOut, sizeof(testOut), &decodedLen, &bitsBeforeCol, 0, false);
+	testCheck("VICC read multiple response", ( (err == ERR_NONE) && (decodedLen == TEST_RX_LEN)
+	                                        && (memcmp(testOut, testFrame, TEST_RX_LEN) == 0) ));
+}
+// END testGolden
+
+
+
+
+
+/****************************************************************************
+* Function Name    : testBench
+* Date             : 10/19/2026
+* Description      : Times the CRC, the coder and the decoder on programming
+* 						size frames and prints ns per byte and per frame.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN testBench
+static void testBench(void)
+{
+	uint64_t start;
+	uint64_t elapsed;
+	uint32_t iterations;
+	uint16_t subbitLen;
+	uint16_t offset;
+	uint16_t outLen;
+	uint16_t streamLen;
+	uint16_t decodedLen;
+	uint16_t bitsBeforeCol;
+	uint16_t i;
+	volatile uint16_t sink = 0;
+
+	// Response frame of the round trip check, still in testFrame
+	streamLen = testBuildStream(testFrame, TEST_RX_LEN);
+
+	iterations = 0;
+	start = testNowNs();
+	do
+	{
+		sink ^= rfalCrcCalculateCcitt(0xFFFFU, testFrame, TEST_RX_LEN);
+		iterations++;
+		elapsed = (testNowNs() - start);
+	}
+	while (elapsed < TEST_BENCH_NS);
+	printf("%-12s %4u bytes %8.1f ns/frame %6.2f ns/byte\n", "CRC", TEST_RX_LEN,
+	       ((double)elapsed / iterations), ((double)elapsed / iterations / TEST_RX_LEN));
+
+	// Request frame: addressed Write Multiple Blocks of 8 blocks
+	testFrame[0] = 0x22;
+	testFrame[1] = 0x24;
+	for (i = 2; i < TEST_TX_LEN; i++)
+	{
+		testFrame[i] = (uint8_t)(i * 13U);
+	}
+
+	iterations = 0;
+	start = testNowNs();
+	do
+	{
+		offset = 0;
+		iso15693VCDCode(testFrame, TEST_TX_LEN, true, true, false, &subbitLen, &offset, testOut, sizeof(testOut), &outLen);
+		sink ^= testOut[outLen / 2U];
+		iterations++;
+		elapsed = (testNowNs() - start);
+	}
+	while (elapsed < TEST_BENCH_NS);
+	printf("%-12s %4u bytes %8.1f ns/frame %6.2f ns/byte\n", "VCD 1of4", (TEST_TX_LEN + 2U),
+	       ((double)elapsed / iterations), ((double)elapsed / iterations / (TEST_TX_LEN + 2U)));
+
+	iterations = 0;
+	start = testNowNs();
+	do
+	{
+		iso15693VICCDecode(testStream, streamLen, testOut, sizeof(testOut), &decodedLen, &bitsBeforeCol, 0, false);
+		sink ^= testOut[decodedLen / 2U];
+		iterations++;
+		elapsed = (testNowNs() - start);
+	}
+	while (elapsed < TEST_BENCH_NS);
+	printf("%-12s %4u bytes %8.1f ns/frame %6.2f ns/byte\n", "VICC decode", TEST_RX_LEN,
+	       ((double)elapsed / iterations), ((double)elapsed / iterations / TEST_RX_LEN));
+
+	(void)sink;
+}
+// END testBench
+
+
+
+
+
+/****************************************************************************
+* Function Name    : testCheck
+* Date             : 10/19/2026
+* Description      : Prints the result of one check and counts failures.
+*
+* Input Parameters : name, check name
+* 					 pass, result of the check
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN testCheck
+static void testCheck( const char *name, bool pass )
+{
+	printf("%-32s %s\n", name, (pass ? "PASS" : "FAIL"));
+	if (!pass)
+	{
+		testFailures++;
+	}
+}
+// END testCheck
+
+
+
+
+
+/****************************************************************************
+* Function Name    : testSetVcdCoding
+* Date             : 10/19/2026
+* Description      : Selects the VCD coding used by iso15693VCDCode.
+*
+* Input Parameters : coding, 1 out of 4 or 1 out of 256
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN testSetVcdCoding
+static void testSetVcdCoding( iso15693VcdCoding_t coding )
+{
+	const struct iso15693StreamConfig *streamCfg;
+	iso15693PhyConfig_t cfg;
+
+	cfg.coding    = coding;
+	cfg.speedMode = 0;
+	iso15693PhyConfigure(&cfg, &streamCfg);
+}
+// END testSetVcdCoding
+
+
+
+
+
+/****************************************************************************
+* Function Name    : testPutBits
+* Date             : 10/19/2026
+* Description      : Appends bits LSB first to a stream buffer.
+*
+* Input Parameters : stream, buffer the bits are written to
+* 					 bitPos, current bit position, advanced
+* 					 bits, bits to append
+* 					 count, number of bits to append
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN testPutBits
+static void testPutBits( uint8_t *stream, uint16_t *bitPos, uint8_t bits, uint8_t count )
+{
+	uint8_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		if (((bits >> i) & 0x01U) != 0U)
+		{
+			stream[*bitPos / 8U] |= (uint8_t)(1U << (*bitPos % 8U));
+		}
+		(*bitPos)++;
+	}
+}
+// END testPutBits
+
+
+
+
+
+/****************************************************************************
+* Function Name    : testBuildStream
+* Date             : 10/19/2026
+* Description      : Builds the manchester stream the ST25R3916 reports for a
+* 						VICC response into testStream: SOF, each data bit as
+* 						a pair (01 for 0, 10 for 1, LSB first) and EOF.
+*
+* Input Parameters : frame, response frame including CRC
+* 					 frameLen, length of frame
+*
+* Return		   : number of stream bytes
+*
+*****************************************************************************/
+
+// BEGIN testBuildStream
+static uint16_t testBuildStream( const uint8_t *frame, uint16_t frameLen )
+{
+	uint16_t bitPos = 0;
+	uint16_t i;
+	uint8_t  b;
+
+	ST_MEMSET(testStream, 0, sizeof(testStream));
+
+	testPutBits(testStream, &bitPos, 0x17U, 5U);                        // SOF
+	for (i = 0; i < frameLen; i++)
+	{
+		for (b = 0; b < 8U; b++)
+		{
+			testPutBits(testStream, &bitPos, ((((frame[i] >> b) & 0x01U) != 0U) ? 0x02U : 0x01U), 2U);
+		}
+	}
+	testPutBits(testStream, &bitPos, 0x1DU, 8U);                        // EOF: 1,0,1,1,1,0,0,0
+
+	return (uint16_t)((bitPos + 7U) / 8U);
+}
+// END testBuildStream
+
+
+
+
+
+/****************************************************************************
+* Function Name    : testSetPair
+* Date             : 10/19/2026
+* Description      : Overwrites the manchester pair of one response bit:
+* 						0x01 for a 0, 0x02 for a 1, 0x00 for a collision.
+*
+* Input Parameters : stream, manchester stream starting with the SOF
+* 					 bit, response bit whose pair is written
+* 					 pair, the two stream bits, first one in bit 0
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN testSetPair
+static void testSetPair( uint8_t *stream, uint16_t bit, uint8_t pair )
+{
+	uint16_t pos = (uint16_t)(5U + (bit * 2U));
+	uint8_t  i;
+
+	for (i = 0; i < 2U; i++, pos++)
+	{
+		stream[pos / 8U] = (uint8_t)(stream[pos / 8U] & ~(1U << (pos % 8U)));
+		stream[pos / 8U] = (uint8_t)(stream[pos / 8U] | (((pair >> i) & 0x01U) << (pos % 8U)));
+	}
+}
+// END testSetPair
+
+
+
+
+
+/****************************************************************************
+* Function Name    : testNowNs
+* Date             : 10/19/2026
+* Description      : Monotonic time in ns.
+*
+* Input Parameters : none
+*
+* Return		   : current time in ns
+*
+*****************************************************************************/
+
+// BEGIN testNowNs
+static uint64_t testNowNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+// END testNowNs
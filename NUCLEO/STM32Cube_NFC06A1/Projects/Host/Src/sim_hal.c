@@ -0,0 +1,837 @@
+/*********************************************************************************
+* File Name :	sim_hal.c
+* Description: Host board implementation file
+*		          Simulated time base, GPIOs, SPI, ST25R3916 interrupt
+*		          line and logger UART of the NUCLEO-L053R8. Every call the
+*		          firmware makes spends the time it takes on the board;
+*		          sims running to a later time go event by event, so the
+*		          chip model and the UART act in order and their
+*		          interrupts are taken as soon as the firmware would take
+*		          them: right away unless the ST25R3916 communication is
+*		          protected or an interrupt is already being served.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "sim_hal.h"
+#include "sim_st25r3916.h"
+#include "st25r3916_irq.h"
+#include "utils.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define SIM_UART_QUEUE       1024U          // bytes the UTF can have on the line ahead of the firmware
+#define SIM_UART_BAUD        19200U         // logger baud rate until HAL_UART_Init sets one
+#define SIM_UART_LINE        256U           // longest line passed to the line hook
+#define SIM_PACE_NS          2000000ULL     // lead of the simulated time over the wall clock before sleeping
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static uint64_t simTime;                    // simulated time, ns
+static bool     simInIrq;                   // an interrupt is being served
+static bool     simRealTime;                // simulated time kept behind the wall clock
+static struct timespec simWallStart;        // wall clock at simInit
+
+static uint16_t simLeds;                    // LED port output
+static bool     simSelected;                // ST25R3916 chip select low
+
+static UART_HandleTypeDef *simUart;         // logger UART, once HAL_UART_Init ran
+static uint32_t simUartCharNs = (10U * 1000000000U) / SIM_UART_BAUD;   // start, 8 data and stop bits
+static uint8_t  simRxQueue[SIM_UART_QUEUE]; // bytes on the RX line
+static uint64_t simRxTime[SIM_UART_QUEUE];  // time each byte is received
+static uint16_t simRxHead;                  // next byte to receive
+static uint16_t simRxCount;                 // bytes queued
+static uint64_t simRxLast;                  // time the last queued byte is received
+static uint64_t simUartActivity;            // time a byte last went over the UART
+static char     simLine[SIM_UART_LINE];     // line being sent
+static uint16_t simLineLen;                 // characters in simLine
+static void     (*simLineHook)(const char *line);
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static void     simRunTo( uint64_t end );
+static uint64_t simNextWake( uint64_t limit );
+static void     simInterrupts( void );
+static void     simPace( void );
+static void     simUartPutChar( char c );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simInit
+* Date             : 10/19/2026
+* Description      : Starts the board at time 0 with the ST25R3916 powered
+* 						and its chip select high.
+*
+* Input Parameters : realTime, true to keep the simulated time behind the
+* 						wall clock, for a terminal user
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simInit
+void simInit(bool realTime)
+{
+	simTime       = 0;
+	simInIrq      = false;
+	simRealTime   = realTime;
+	simLeds       = 0;
+	simSelected   = false;
+	simRxHead     = 0;
+	simRxCount    = 0;
+	simRxLast     = 0;
+	simLineLen    = 0;
+	clock_gettime(CLOCK_MONOTONIC, &simWallStart);
+
+	simChipInit();
+}
+// END simInit
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simNow
+* Date             : 10/19/2026
+* Description      : Simulated time since simInit.
+*
+* Input Parameters : none
+*
+* Return		   : time in ns
+*
+*****************************************************************************/
+
+// BEGIN simNow
+uint64_t simNow(void)
+{
+	return simTime;
+}
+// END simNow
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simSpend
+* Date             : 10/19/2026
+* Description      : Lets the firmware spend time. The chip events falling
+* 						in it run, and the pending interrupts are taken once
+* 						it is over.
+*
+* Input Parameters : ns, time spent
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simSpend
+void simSpend(uint32_t ns)
+{
+	simRunTo(simTime + ns);
+}
+// END simSpend
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simSleep
+* Date             : 10/19/2026
+* Description      : WFI: jumps to the next interrupt, the next SysTick at
+* 						the latest.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simSleep
+void simSleep(void)
+{
+	simRunTo(simNextWake(((simTime / SIM_NS_MS) + 1U) * SIM_NS_MS));
+}
+// END simSleep
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simIrqEnable
+* Date             : 10/19/2026
+* Description      : NVIC_EnableIRQ of the ST25R3916 line: takes the
+* 						interrupt at once if the line is high.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simIrqEnable
+void simIrqEnable(void)
+{
+	simSpend(SIM_HOOK_NS);
+}
+// END simIrqEnable
+
+
+
+
+
+/****************************************************************************
+* Function Name    : HAL_GetTick
+* Date             : 10/19/2026
+* Description      : SysTick count, read after the time it takes to get it.
+*
+* Input Parameters : none
+*
+* Return		   : ms since simInit
+*
+*****************************************************************************/
+
+// BEGIN HAL_GetTick
+uint32_t HAL_GetTick(void)
+{
+	simSpend(SIM_TICK_NS);
+
+	return (uint32_t)(simTime / SIM_NS_MS);
+}
+// END HAL_GetTick
+
+
+
+
+
+/****************************************************************************
+* Function Name    : HAL_Delay
+* Date             : 10/19/2026
+* Description      : Waits until Delay + 1 SysTicks went by, as the HAL
+* 						does to wait at least the given time. Interrupts
+* 						are taken meanwhile.
+*
+* Input Parameters : Delay, ms
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN HAL_Delay
+void HAL_Delay(uint32_t Delay)
+{
+	uint64_t end = (((simTime / SIM_NS_MS) + Delay + 1U) * SIM_NS_MS);
+
+	while (simTime < end)
+	{
+		simRunTo(simNextWake(end));
+	}
+}
+// END HAL_Delay
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simGetTickUs
+* Date             : 10/19/2026
+* Description      : 16 bit us time base.
+*
+* Input Parameters : none
+*
+* Return		   : us since simInit, modulo 65536
+*
+*****************************************************************************/
+
+// BEGIN simGetTickUs
+uint16_t simGetTickUs(void)
+{
+	simSpend(SIM_TICK_NS);
+
+	return (uint16_t)(simTime / 1000U);
+}
+// END simGetTickUs
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simGetCycleStamp
+* Date             : 10/19/2026
+* Description      : Core cycles elapsed in the current SysTick period.
+*
+* Input Parameters : none
+*
+* Return		   : cycles, 0 to SIM_CORE_HZ / 1000 - 1
+*
+*****************************************************************************/
+
+// BEGIN simGetCycleStamp
+uint32_t simGetCycleStamp(void)
+{
+	return (uint32_t)(((simTime % SIM_NS_MS) * (SIM_CORE_HZ / 1000U)) / SIM_NS_MS);
+}
+// END simGetCycleStamp
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simGpioWrite
+* Date             : 10/19/2026
+* Description      : Drives an output. The chip select goes to the
+* 						ST25R3916 model.
+*
+* Input Parameters : port, SIM_PORT_xxx
+* 					 pin, SIM_PIN_xxx
+* 					 high, level
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simGpioWrite
+void simGpioWrite(void *port, uint16_t pin, bool high)
+{
+	if (port == SIM_PORT_SPI)
+	{
+		if ((pin == SIM_PIN_SS) && (simSelected == high))
+		{
+			simSelected = !high;
+			simChipSelect(simSelected);
+		}
+	}
+	else
+	{
+		simLeds = (high ? (uint16_t)(simLeds | pin) : (uint16_t)(simLeds & ~pin));
+	}
+
+	simSpend(SIM_HOOK_NS);
+}
+// END simGpioWrite
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simGpioToggle
+* Date             : 10/19/2026
+* Description      : Toggles an output.
+*
+* Input Parameters : port, SIM_PORT_xxx
+* 					 pin, SIM_PIN_xxx
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simGpioToggle
+void simGpioToggle(void *port, uint16_t pin)
+{
+	simGpioWrite(port, pin, !simGpioIsHigh(port, pin));
+}
+// END simGpioToggle
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simGpioIsHigh
+* Date             : 10/19/2026
+* Description      : Reads a pin. The interrupt line comes from the
+* 						ST25R3916 model.
+*
+* Input Parameters : port, SIM_PORT_xxx
+* 					 pin, SIM_PIN_xxx
+*
+* Return		   : true if the pin is high
+*
+*****************************************************************************/
+
+// BEGIN simGpioIsHigh
+bool simGpioIsHigh(void *port, uint16_t pin)
+{
+	simSpend(SIM_HOOK_NS);
+
+	if (port == SIM_PORT_SPI)
+	{
+		return ((pin == SIM_PIN_IRQ) ? simChipIrq() : !simSelected);
+	}
+
+	return ((simLeds & pin) != 0U);
+}
+// END simGpioIsHigh
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simSpiTxRx
+* Date             : 10/19/2026
+* Description      : Full duplex SPI transfer with the ST25R3916 model,
+* 						timed as on the 4 MHz bus.
+*
+* Input Parameters : txBuf, bytes sent, NULL to send 0x00
+* 					 rxBuf, bytes received, NULL to drop them
+* 					 len, bytes transferred
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simSpiTxRx
+void simSpiTxRx(const uint8_t *txBuf, uint8_t *rxBuf, uint16_t len)
+{
+	static const uint8_t zeros[SIM_UART_QUEUE];
+	uint8_t  drop[SIM_UART_QUEUE];
+	uint16_t done;
+	uint16_t n;
+
+	for (done = 0; done < len; done += n)
+	{
+		n = (uint16_t)MIN((uint16_t)(len - done), SIM_UART_QUEUE);
+		simChipSpi(((txBuf != NULL) ? &txBuf[done] : zeros), ((rxBuf != NULL) ? &rxBuf[done] : drop), n);
+	}
+
+	simSpend(SIM_SPI_CALL_NS + ((uint32_t)len * SIM_SPI_BYTE_NS));
+}
+// END simSpiTxRx
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simErrorHandle
+* Date             : 10/19/2026
+* Description      : _Error_Handler of the board: reports where and stops.
+*
+* Input Parameters : file, source file
+* 					 line, source line
+*
+* Return		   : none, exits
+*
+*****************************************************************************/
+
+// BEGIN simErrorHandle
+void simErrorHandle(const char *file, int line)
+{
+	fflush(stdout);
+	fprintf(stderr, "sim: error handler at %s:%d, %.3f s\n", file, line, (double)simTime / 1e9);
+	exit(2);
+}
+// END simErrorHandle
+
+
+
+
+
+/****************************************************************************
+* Function Name    : HAL_UART_Init
+* Date             : 10/19/2026
+* Description      : Takes the baud rate of the logger UART.
+*
+* Input Parameters : huart, UART handle
+*
+* Return		   : HAL_OK
+*
+*****************************************************************************/
+
+// BEGIN HAL_UART_Init
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+	simUart            = huart;
+	simUart->pRxBuffPtr = NULL;
+	if (huart->Init.BaudRate != 0U)
+	{
+		simUartCharNs = ((10U * 1000000000U) / huart->Init.BaudRate);
+	}
+
+	return HAL_OK;
+}
+// END HAL_UART_Init
+
+
+
+
+
+/****************************************************************************
+* Function Name    : HAL_UART_Transmit
+* Date             : 10/19/2026
+* Description      : Blocking send: the bytes go to stdout, the firmware
+* 						waits for them to leave at the baud rate.
+*
+* Input Parameters : huart, UART handle
+* 					 pData, bytes to send
+* 					 Size, bytes in pData
+* 					 Timeout, ms, never reached
+*
+* Return		   : HAL_OK
+*
+*****************************************************************************/
+
+// BEGIN HAL_UART_Transmit
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	uint16_t i;
+
+	fwrite(pData, 1U, Size, stdout);
+	fflush(stdout);
+
+	for (i = 0; i < Size; i++)
+	{
+		simUartPutChar((char)pData[i]);
+		simSpend(simUartCharNs);
+	}
+	simUartActivity = simTime;
+
+	return HAL_OK;
+}
+// END HAL_UART_Transmit
+
+
+
+
+
+/****************************************************************************
+* Function Name    : HAL_UART_Receive_IT
+* Date             : 10/19/2026
+* Description      : Arms the reception of the next byte, received into
+* 						pData by the RX interrupt.
+*
+* Input Parameters : huart, UART handle
+* 					 pData, buffer of the byte
+* 					 Size, 1, the logger receives byte by byte
+*
+* Return		   : HAL_OK, HAL_BUSY if a reception is armed already
+*
+*****************************************************************************/
+
+// BEGIN HAL_UART_Receive_IT
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+	if (huart->pRxBuffPtr != NULL)
+	{
+		return HAL_BUSY;
+	}
+
+	huart->pRxBuffPtr = pData;
+
+	return HAL_OK;
+}
+// END HAL_UART_Receive_IT
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simUartFeed
+* Date             : 10/19/2026
+* Description      : Queues a byte on the UART RX line, it arrives one
+* 						character time after the previous one.
+*
+* Input Parameters : byte, byte sent by the UTF
+*
+* Return		   : false if the queue is full
+*
+*****************************************************************************/
+
+// BEGIN simUartFeed
+bool simUartFeed(uint8_t byte)
+{
+	uint16_t slot;
+
+	if (simRxCount == SIM_UART_QUEUE)
+	{
+		return false;
+	}
+
+	simRxLast = (MAX(simRxLast, simTime) + simUartCharNs);
+	slot      = (uint16_t)((simRxHead + simRxCount) % SIM_UART_QUEUE);
+	simRxQueue[slot] = byte;
+	simRxTime[slot]  = simRxLast;
+	simRxCount++;
+
+	return true;
+}
+// END simUartFeed
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simUartRxIdle
+* Date             : 10/19/2026
+* Description      : Tells whether every queued byte has been received.
+*
+* Input Parameters : none
+*
+* Return		   : true if the RX line is idle
+*
+*****************************************************************************/
+
+// BEGIN simUartRxIdle
+bool simUartRxIdle(void)
+{
+	return (simRxCount == 0U);
+}
+// END simUartRxIdle
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simUartLastActivity
+* Date             : 10/19/2026
+* Description      : Time the UART last sent or received a byte.
+*
+* Input Parameters : none
+*
+* Return		   : time in ns
+*
+*****************************************************************************/
+
+// BEGIN simUartLastActivity
+uint64_t simUartLastActivity(void)
+{
+	return simUartActivity;
+}
+// END simUartLastActivity
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simUartSetLineHook
+* Date             : 10/19/2026
+* Description      : Sets the function told about every line the firmware
+* 						sends, without its end of line.
+*
+* Input Parameters : hook, function called, NULL for none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simUartSetLineHook
+void simUartSetLineHook(void (*hook)(const char *line))
+{
+	simLineHook = hook;
+}
+// END simUartSetLineHook
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simRunTo
+* Date             : 10/19/2026
+* Description      : Moves the time to end, running the chip events and
+* 						taking the interrupts on the way.
+*
+* Input Parameters : end, time to reach in ns
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simRunTo
+static void simRunTo( uint64_t end )
+{
+	uint64_t next;
+
+	do
+	{
+		next = MIN(simChipNextEvent(), end);
+		if (next > simTime)
+		{
+			simTime = next;
+		}
+		simChipRun(simTime);
+		simInterrupts();
+	}
+	while (simTime < end);
+
+	simPace();
+}
+// END simRunTo
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simNextWake
+* Date             : 10/19/2026
+* Description      : Time of the next interrupt source: a chip event or a
+* 						UART byte waited for.
+*
+* Input Parameters : limit, latest time returned
+*
+* Return		   : time in ns, after the current time
+*
+*****************************************************************************/
+
+// BEGIN simNextWake
+static uint64_t simNextWake( uint64_t limit )
+{
+	uint64_t wake = MIN(simChipNextEvent(), limit);
+
+	if ((simRxCount != 0U) && (simUart != NULL) && (simUart->pRxBuffPtr != NULL))
+	{
+		wake = MIN(wake, simRxTime[simRxHead]);
+	}
+
+	return MAX(wake, (simTime + SIM_HOOK_NS));
+}
+// END simNextWake
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simInterrupts
+* Date             : 10/19/2026
+* Description      : Takes the pending interrupts: the ST25R3916 line unless
+* 						its communication is protected, then the UART byte
+* 						received. Interrupts do not nest.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simInterrupts
+static void simInterrupts( void )
+{
+	UART_HandleTypeDef *huart = simUart;
+
+	if (simInIrq)
+	{
+		return;
+	}
+	simInIrq = true;
+
+	if ((globalCommProtectCnt == 0U) && simChipIrq())
+	{
+		st25r3916Isr();
+	}
+
+	if ((simRxCount != 0U) && (huart != NULL) && (huart->pRxBuffPtr != NULL) && (simRxTime[simRxHead] <= simTime))
+	{
+		*huart->pRxBuffPtr = simRxQueue[simRxHead];
+		huart->pRxBuffPtr  = NULL;
+		simRxHead          = (uint16_t)((simRxHead + 1U) % SIM_UART_QUEUE);
+		simRxCount--;
+		simUartActivity    = simTime;
+		HAL_UART_RxCpltCallback(huart);
+	}
+
+	simInIrq = false;
+}
+// END simInterrupts
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simPace
+* Date             : 10/19/2026
+* Description      : In real time, sleeps while the simulated time is ahead
+* 						of the wall clock.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simPace
+static void simPace( void )
+{
+	struct timespec now;
+	struct timespec wait;
+	uint64_t        wall;
+
+	if (!simRealTime)
+	{
+		return;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	wall = (((uint64_t)(now.tv_sec - simWallStart.tv_sec) * 1000000000ULL) + (uint64_t)now.tv_nsec) - (uint64_t)simWallStart.tv_nsec;
+	if (simTime > (wall + SIM_PACE_NS))
+	{
+		wait.tv_sec  = (time_t)((simTime - wall) / 1000000000ULL);
+		wait.tv_nsec = (long)((simTime - wall) % 1000000000ULL);
+		nanosleep(&wait, NULL);
+	}
+}
+// END simPace
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simUartPutChar
+* Date             : 10/19/2026
+* Description      : Collects the characters sent into lines for the line
+* 						hook.
+*
+* Input Parameters : c, character sent
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simUartPutChar
+static void simUartPutChar( char c )
+{
+	if (c == '\n')
+	{
+		simLine[simLineLen] = '\0';
+		simLineLen = 0;
+		if (simLineHook != NULL)
+		{
+			simLineHook(simLine);
+		}
+	}
+	else if ((c != '\r') && (simLineLen < (SIM_UART_LINE - 1U)))
+	{
+		simLine[simLineLen++] = c;
+	}
+}
+// END simUartPutChar
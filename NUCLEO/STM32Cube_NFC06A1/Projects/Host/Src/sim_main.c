@@ -0,0 +1,484 @@
+/*********************************************************************************
+* File Name :	sim_main.c
+* Description: Host simulator main implementation file
+*		          Runs the firmware of the station on the simulated board:
+*		          the same init sequence and tagFinder loop as main.c,
+*		          with the units of sim_st25dv.c on the fixture. The UTF
+*		          commands come from stdin as raw bytes, exactly as the
+*		          UTF sends them; like the UTF, the simulator sends one
+*		          command and waits for its reply before the next. The
+*		          replies go to stdout. A unit that passed or failed is
+*		          replaced by a new one, and a PASS is only counted once
+*		          the recipe is found in the EEPROM of a unit. At the end
+*		          of stdin a summary of the run goes to stderr: results,
+*		          RF traffic, simulated time and CPU time. The exit status
+*		          is 0 if every program command passed, within the cycle
+*		          time limit if one is given.
+*
+*		          sim [-u units] [-i] [-c] [-r] [-b name] [-t ms] < commands
+*		              -u  units on the fixture, 1 to SIM_TAG_MAX (1)
+*		              -i  units carry an ICM reading the mailbox
+*		              -c  units were configured by a previous station
+*		              -r  keep the simulated time behind the wall clock
+*		              -b  summary as one row of the benchmark table of
+*		                  'make bench', per unit, under the given name
+*		              -t  fail if the mean cycle time of a unit, from
+*		                  the command to its result, is over ms
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "demo.h"
+#include "utils.h"
+#include "sim_hal.h"
+#include "sim_st25r3916.h"
+#include "sim_st25dv.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define SIM_REPLY_MS         15000U         // longest wait for the reply to a command, no unit in the field included
+#define SIM_REPLY_QUIET_MS   50U            // UART quiet time closing a reply of several lines
+#define SIM_CMD_MAX          (1U + TARGET_LEN + PROGRAM_LEN)   // longest command, 'U'
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+uint8_t globalCommProtectCnt = 0;   /*!< Global Protection counter     */
+UART_HandleTypeDef hlogger;         /*!< Handler to the UART HW logger */
+
+static uint8_t  simUnits = 1;               // units on the fixture
+static uint8_t  simOptions;                 // SIM_TAG_xxx of the units
+static uint8_t  simCmd[SIM_CMD_MAX];        // command waiting for its reply
+static uint8_t  simCmdLen;                  // bytes in simCmd, 0 if no command is waiting
+static uint64_t simCmdTime;                 // time the command was sent
+static bool     simReplied;                 // a line came back since the command
+static bool     simResult;                  // the line was the PASS, FAIL or CHECKSUM_ERR of a program command
+static bool     simPassed;                  // the result was PASS
+static uint32_t simPass;                    // program commands passed, recipe found
+static uint32_t simFail;                    // program commands failed, unanswered or not found in the EEPROM
+static uint32_t simCommands;                // commands sent
+static uint64_t simCycleNs;                 // command to result time of the program commands, summed
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static bool    simSummary( const char *bench, uint32_t limitMs, double cpuS );
+static void    simLine( const char *line );
+static bool    simReadCommand( bool realTime );
+static bool    simReplyDone( void );
+static void    simResultDone( void );
+static bool    simRecipeFound( void );
+static uint8_t simCommandLen( uint8_t first );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : main
+* Date             : 10/19/2026
+* Description      : Host entry point. Same init sequence as main.c, then
+* 						the tagFinder loop, fed from stdin until it ends.
+*
+* Input Parameters : argc, argv, options above
+*
+* Return		   : 0 if every program command passed within the cycle
+* 					 time limit, 1 otherwise
+*
+*****************************************************************************/
+
+// BEGIN main
+int main(int argc, char **argv)
+{
+	bool     realTime = false;		// keep the simulated time behind the wall clock
+	bool     inputEnd = false;		// stdin ended
+	bool     inLimit;				// cycle time within the limit
+	const char *bench = NULL;		// benchmark row name, NULL for the summary
+	uint32_t limitMs  = 0;			// cycle time limit, 0 for none
+	int      opt;
+	clock_t  cpuStart;
+
+
+	// Read the options
+	while ((opt = getopt(argc, argv, "u:icrb:t:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'u': simUnits = (uint8_t)MIN(MAX(atoi(optarg), 1), (int)SIM_TAG_MAX); break;
+			case 'i': simOptions |= SIM_TAG_ICM;                                      break;
+			case 'c': simOptions |= SIM_TAG_CONFIGURED;                               break;
+			case 'r': realTime = true;                                                break;
+			case 'b': bench    = optarg;                                              break;
+			case 't': limitMs  = (uint32_t)atoi(optarg);                              break;
+			default:
+				fprintf(stderr, "usage: %s [-u units] [-i] [-c] [-r] [-b name] [-t ms] < commands\n", argv[0]);
+				return 2;
+		}
+	}
+
+	cpuStart = clock();
+	simInit(realTime);
+	simTagsPlace(simUnits, simOptions);
+	simUartSetLineHook(simLine);
+
+	// Same init sequence as main.c, the LEDs and buses are ready on the simulated board
+	logUsartInit(&hlogger);
+	init_UART_RX();
+	bootMark("uart");
+
+	if (!init_TagFinder())
+	{
+		fprintf(stderr, "sim: rfal initialization failed\n");
+		return 2;
+	}
+	bootMark("ready");
+
+	// WHILE stdin has commands or a reply is awaited
+	while (!inputEnd || (simCmdLen != 0U))
+	{
+		// Close the pending command once its reply is in, then send the next one
+		if ((simCmdLen != 0U) && simReplyDone())
+		{
+			simCmdLen = 0;
+		}
+
+		if ((simCmdLen == 0U) && !inputEnd)
+		{
+			inputEnd = !simReadCommand(realTime);
+		}
+
+		/* Run Tag Finder Application */
+		(void)tagFinder();
+	}
+	// END WHILE
+
+	fflush(stdout);
+	inLimit = simSummary(bench, limitMs, ((double)(clock() - cpuStart) / CLOCKS_PER_SEC));
+
+	return (((simFail == 0U) && inLimit) ? 0 : 1);
+}
+// END main
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simSummary
+* Date             : 10/19/2026
+* Description      : Reports the run on stderr: results, RF traffic,
+* 						simulated and CPU time. As a benchmark row, the
+* 						traffic and times are given per unit programmed.
+*
+* Input Parameters : bench, name of the benchmark row, NULL for the summary
+* 					 limitMs, cycle time limit, 0 for none
+* 					 cpuS, CPU time of the run in s
+*
+* Return		   : false if the cycle time is over the limit
+*
+*****************************************************************************/
+
+// BEGIN simSummary
+static bool simSummary( const char *bench, uint32_t limitMs, double cpuS )
+{
+	SimChipStats stats;
+	double       units  = (double)MAX(simPass, 1U);
+	double       cycle  = ((double)simCycleNs / units) / 1e6;
+
+	simChipGetStats(&stats);
+
+	if (bench != NULL)
+	{
+		fprintf(stderr, "%-16s %6u %5u %8.1f %8.1f %8.2f %9.1f %8.1f\n", bench, (unsigned)simPass, (unsigned)simFail,
+				(double)stats.frames / units, (double)(stats.txBytes + stats.rxBytes) / units,
+				((double)stats.airNs / 1e6) / units, cycle, (cpuS * 1e6) / units);
+	}
+	else
+	{
+		fprintf(stderr, "sim: %u commands, %u PASS, %u FAIL, %u units on the fixture\n",
+				(unsigned)simCommands, (unsigned)simPass, (unsigned)simFail, (unsigned)simUnits);
+		fprintf(stderr, "sim: %u frames, %u answered, %u bytes tx, %u bytes rx, air %.3f ms\n",
+				(unsigned)stats.frames, (unsigned)stats.answered, (unsigned)stats.txBytes, (unsigned)stats.rxBytes, (double)stats.airNs / 1e6);
+		fprintf(stderr, "sim: simulated %.3f s, cpu %.3f s, cycle %.1f ms per unit\n", (double)simNow() / 1e9, cpuS, cycle);
+	}
+
+	if ((limitMs != 0U) && (cycle > (double)limitMs))
+	{
+		fprintf(stderr, "sim: cycle time %.1f ms over the %u ms limit\n", cycle, (unsigned)limitMs);
+		return false;
+	}
+
+	return true;
+}
+// END simSummary
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simLine
+* Date             : 10/19/2026
+* Description      : Line hook of the UART: notes the reply to the command
+* 						waiting for it.
+*
+* Input Parameters : line, line sent by the firmware, without its end of
+* 						line
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simLine
+static void simLine( const char *line )
+{
+	if ((simCmdLen == 0U) || simResult)
+	{
+		return;
+	}
+
+	simReplied = true;
+
+	// Program commands end on their result line, gang mode sends one line per unit before it
+	if (((simCmd[0] == 'P') || (simCmd[0] == 'U')) &&
+		((strcmp(line, "PASS") == 0) || (strcmp(line, "FAIL") == 0) || (strcmp(line, "CHECKSUM_ERR") == 0)))
+	{
+		simResult = true;
+		simPassed = (strcmp(line, "PASS") == 0);
+	}
+}
+// END simLine
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simReadCommand
+* Date             : 10/19/2026
+* Description      : Reads the next command from stdin and puts it on the
+* 						UART RX line. In real time, returns at once if
+* 						nothing was typed.
+*
+* Input Parameters : realTime, the simulator runs in real time
+*
+* Return		   : false at the end of stdin
+*
+*****************************************************************************/
+
+// BEGIN simReadCommand
+static bool simReadCommand( bool realTime )
+{
+	struct pollfd in = { .fd = STDIN_FILENO, .events = POLLIN };
+	int      c;
+	uint8_t  len;
+
+
+	if (realTime && (poll(&in, 1, 0) == 0))
+	{
+		return true;
+	}
+
+	if ((c = getchar()) == EOF)
+	{
+		return false;
+	}
+
+	simCmd[0] = (uint8_t)c;
+	len       = simCommandLen(simCmd[0]);
+
+	for (simCmdLen = 1; simCmdLen < len; simCmdLen++)
+	{
+		if ((c = getchar()) == EOF)
+		{
+			fprintf(stderr, "sim: command '%c' cut short by the end of stdin\n", simCmd[0]);
+			simFail++;
+			simCmdLen = 0;
+			return false;
+		}
+		simCmd[simCmdLen] = (uint8_t)c;
+	}
+
+	for (uint8_t i = 0; i < len; i++)
+	{
+		(void)simUartFeed(simCmd[i]);
+	}
+
+	// Bytes the firmware ignores, such as line ends, get no reply
+	if (!((simCmd[0] == '?') || (simCmd[0] == 'P') || (simCmd[0] == 'U') ||
+		  (simCmd[0] == 'S') || (simCmd[0] == 'D') || (simCmd[0] == 'R') || (simCmd[0] == 'M')))
+	{
+		simCmdLen = 0;
+		return true;
+	}
+
+	simCommands++;
+	simCmdTime = simNow();
+	simReplied = false;
+	simResult  = false;
+	simPassed  = false;
+	return true;
+}
+// END simReadCommand
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simReplyDone
+* Date             : 10/19/2026
+* Description      : Tells whether the command waiting got its whole reply:
+* 						the result line of a program command, or the lines
+* 						of another command followed by a quiet UART. A
+* 						command left unanswered is given up after
+* 						SIM_REPLY_MS.
+*
+* Input Parameters : none
+*
+* Return		   : true if the next command can be sent
+*
+*****************************************************************************/
+
+// BEGIN simReplyDone
+static bool simReplyDone( void )
+{
+	bool program = ((simCmd[0] == 'P') || (simCmd[0] == 'U'));
+
+
+	if (simResult)
+	{
+		simResultDone();
+		return true;
+	}
+
+	if (!program && simReplied && simUartRxIdle() &&
+		((simNow() - simUartLastActivity()) >= (SIM_REPLY_QUIET_MS * SIM_NS_MS)))
+	{
+		return true;
+	}
+
+	if ((simNow() - simCmdTime) >= (SIM_REPLY_MS * SIM_NS_MS))
+	{
+		fprintf(stderr, "sim: no reply to '%c' after %u ms\n", simCmd[0], SIM_REPLY_MS);
+		if (program)
+		{
+			simFail++;
+		}
+		return true;
+	}
+
+	return false;
+}
+// END simReplyDone
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simResultDone
+* Date             : 10/19/2026
+* Description      : Counts the result of a program command and, as the
+* 						operator does, puts new units on the fixture.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simResultDone
+static void simResultDone( void )
+{
+	if (simPassed && simRecipeFound())
+	{
+		simPass++;
+		simCycleNs += (simNow() - simCmdTime);
+	}
+	else
+	{
+		if (simPassed)
+		{
+			fprintf(stderr, "sim: PASS but no unit holds the recipe\n");
+		}
+		simFail++;
+	}
+
+	simTagsPlace(simUnits, simOptions);
+}
+// END simResultDone
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simRecipeFound
+* Date             : 10/19/2026
+* Description      : Looks for the program of the last command in the
+* 						recipe blocks of the units in the field.
+*
+* Input Parameters : none
+*
+* Return		   : true if a unit holds it
+*
+*****************************************************************************/
+
+// BEGIN simRecipeFound
+static bool simRecipeFound( void )
+{
+	uint8_t        recipe[PROGRAM_LEN];
+	const uint8_t *sent = &simCmd[(simCmd[0] == 'U') ? (1U + TARGET_LEN) : 1U];
+
+
+	for (uint8_t tag = 0; simTagsRead(tag, (RECIPE_START_BLOCK + 1U), recipe, PROGRAM_LEN); tag++)
+	{
+		if (memcmp(recipe, sent, PROGRAM_LEN) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+// END simRecipeFound
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simCommandLen
+* Date             : 10/19/2026
+* Description      : Length of a UTF command, as loggerRxByte parses it.
+*
+* Input Parameters : first, first byte of the command
+*
+* Return		   : bytes in the command
+*
+*****************************************************************************/
+
+// BEGIN simCommandLen
+static uint8_t simCommandLen( uint8_t first )
+{
+	switch (first)
+	{
+		case 'P': return (1U + PROGRAM_LEN);
+		case 'U': return (1U + TARGET_LEN + PROGRAM_LEN);
+		default:  return 1U;
+	}
+}
+// END simCommandLen
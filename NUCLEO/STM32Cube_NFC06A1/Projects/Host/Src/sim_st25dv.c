@@ -0,0 +1,1004 @@
+/*********************************************************************************
+* File Name :	sim_st25dv.c
+* Description: ST25DV04K model implementation file
+*		          The units on the fixture, answering the requests the
+*		          ST25R3916 model decodes. Each unit keeps its ISO15693
+*		          state (ready, selected, quiet), its EEPROM of 128
+*		          blocks, the RF passwords with the one security session
+*		          a password opens, the static RFA1SS and MB_MODE
+*		          registers and the fast transfer mailbox. The whole
+*		          memory is area 1, as ENDA1 leaves it from the factory.
+*		          Responses are timed from the end of the request: t1,
+*		          plus the EEPROM programming time of the writes.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "sim_st25dv.h"
+#include "rfal_nfcv.h"
+#include "rfal_st25xv.h"
+#include "rfal_crc.h"
+#include "utils.h"
+#include <string.h>
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define SIM_TAG_BLOCKS       128U           // ST25DV04K user memory blocks
+#define SIM_TAG_BLOCK_SIZE   4U             // bytes per block
+#define SIM_TAG_IC_REF       0x24U          // ST25DV04K IC reference
+#define SIM_TAG_PWDS         4U             // configuration password and areas 1 to 3
+#define SIM_TAG_PWD_LEN      8U             // bytes of a password
+#define SIM_TAG_NO_SESSION   0xFFU          // no password presented
+#define SIM_TAG_NO_SLOT      0xFFU          // not waiting for an inventory slot
+#define SIM_TAG_WRITE_BLOCKS 4U             // blocks taken by one Write Multiple Blocks
+#define SIM_TAG_MB_LEN       256U           // mailbox size
+#define SIM_TAG_CRC_RESIDUE  0xF0B8U        // CRC of a frame with its CRC appended
+
+#define SIM_TAG_FC_NS(n)     (((uint64_t)(n) * 1000000000ULL) / 13560000ULL)   // n carrier periods
+#define SIM_TAG_T1_NS        ((uint32_t)SIM_TAG_FC_NS(4320U))  // response delay t1
+#define SIM_TAG_WRITE_NS     5000000U       // EEPROM programming time of one block
+#define SIM_TAG_CFG_NS       5500000U       // programming time of a configuration register
+#define SIM_TAG_PWD_NS       (2U * SIM_TAG_WRITE_NS)   // programming time of a password
+#define SIM_TAG_ICM_NS       2000000ULL     // time the ICM takes to read a message put by RF
+
+#define SIM_TAG_RFA1SS       0x04U          // static register: RF area 1 security status
+#define SIM_TAG_MB_MODE      0x0DU          // static register: mailbox allowed
+#define SIM_TAG_CFG_REGS     0x10U          // static registers modelled
+#define SIM_TAG_MB_CTRL_DYN  0x0DU          // dynamic register: mailbox control
+#define SIM_TAG_MB_EN        0x01U          // mailbox on
+#define SIM_TAG_HOST_PUT     0x02U          // message put by the host
+#define SIM_TAG_RF_PUT       0x04U          // message put by RF
+#define SIM_TAG_RECIPE_BLOCK 57U            // block the ICM stores the recipe from, RECIPE_START_BLOCK + 1
+
+#define SIM_TAG_ERR_NOT_SUPPORTED  0x01U    // command not supported
+#define SIM_TAG_ERR_UNKNOWN        0x0FU    // wrong password, mailbox busy or off
+#define SIM_TAG_ERR_NOT_AVAILABLE  0x10U    // block out of the memory
+#define SIM_TAG_ERR_LOCKED         0x12U    // write protected
+#define SIM_TAG_ERR_READ_DENIED    0x15U    // read protected
+
+// ISO15693 states of a unit in the field
+typedef enum
+{
+	SIM_TAG_READY,
+	SIM_TAG_SELECTED,
+	SIM_TAG_QUIET
+} SimTagState;
+
+// One unit on the fixture
+typedef struct
+{
+	uint8_t     uid[RFAL_NFCV_UID_LEN];                     // least significant byte first, as on air
+	uint8_t     mem[SIM_TAG_BLOCKS * SIM_TAG_BLOCK_SIZE];   // user EEPROM
+	uint8_t     pwd[SIM_TAG_PWDS][SIM_TAG_PWD_LEN];         // RF passwords
+	uint8_t     cfg[SIM_TAG_CFG_REGS];                      // static configuration
+	uint8_t     session;                                    // password presented, SIM_TAG_NO_SESSION if none
+	SimTagState state;
+	uint8_t     slot;                                       // inventory slot the unit answers in
+	uint8_t     mbCtrl;                                     // MB_CTRL_Dyn
+	uint8_t     mb[SIM_TAG_MB_LEN];                         // mailbox
+	uint16_t    mbLen;                                      // bytes of the message in the mailbox
+	uint64_t    icmDue;                                     // time the ICM reads the message, 0 if none
+} SimTag;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static SimTag   tags[SIM_TAG_MAX];
+static uint8_t  tagCount;               // units on the fixture
+static uint32_t tagSerial;              // serial number of the last unit placed
+static uint8_t  tagSlot;                // current slot of a 16 slot inventory
+static const uint8_t tagConfiguredPwd[SIM_TAG_PWD_LEN] = { 'p', 'w', 'd', '1', '2', '3', '4', '5' };   // passwords of demo_polling.c
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static void     simTagIcm( SimTag *tag );
+static bool     simTagMaskMatch( const SimTag *tag, uint8_t maskLen, const uint8_t *mask );
+static uint8_t  simTagSlotBits( const SimTag *tag, uint8_t maskLen );
+static void     simTagInventoryReply( const SimTag *tag, SimTagReply *reply );
+static void     simTagCommand( SimTag *tag, uint8_t flags, uint8_t cmd, uint8_t param, const uint8_t *p, uint16_t n, SimTagReply *reply );
+static void     simTagRead( SimTag *tag, uint8_t flags, uint16_t block, uint16_t count, SimTagReply *reply );
+static void     simTagWrite( SimTag *tag, uint16_t block, uint16_t count, const uint8_t *data, uint16_t n, SimTagReply *reply );
+static void     simTagSysInfo( const SimTag *tag, uint8_t request, bool extended, SimTagReply *reply );
+static bool     simTagCanRead( const SimTag *tag );
+static bool     simTagCanWrite( const SimTag *tag );
+static void     simTagError( SimTagReply *reply, uint8_t code );
+static void     simTagFinish( SimTagReply *reply );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagsPlace
+* Date             : 10/19/2026
+* Description      : Takes the units off the fixture and places new ones,
+* 						in their factory state unless told otherwise. Each
+* 						unit gets the next serial number of the run.
+*
+* Input Parameters : count, units placed, 0 to SIM_TAG_MAX
+* 					 options, SIM_TAG_xxx
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simTagsPlace
+void simTagsPlace(uint8_t count, uint8_t options)
+{
+	SimTag  *tag;
+	uint8_t  i;
+	uint8_t  pwd;
+
+	tagCount = MIN(count, SIM_TAG_MAX);
+	for (i = 0; i < tagCount; i++)
+	{
+		tag = &tags[i];
+		ST_MEMSET(tag, 0, sizeof(SimTag));
+		tagSerial++;
+
+		// E0 02 24 and the serial number, sent least significant byte first
+		tag->uid[0] = (uint8_t)(tagSerial >> 0U);
+		tag->uid[1] = (uint8_t)(tagSerial >> 8U);
+		tag->uid[2] = (uint8_t)(tagSerial >> 16U);
+		tag->uid[3] = (uint8_t)(tagSerial >> 24U);
+		tag->uid[5] = SIM_TAG_IC_REF;
+		tag->uid[6] = RFAL_NFCV_ST_IC_MFG_CODE;
+		tag->uid[7] = 0xE0U;
+
+		tag->session = SIM_TAG_NO_SESSION;
+		tag->slot    = SIM_TAG_NO_SLOT;
+		tag->state   = SIM_TAG_READY;
+		tag->cfg[SIM_TAG_MB_MODE] = (((options & SIM_TAG_ICM) != 0U) ? 0x01U : 0x00U);
+
+		if ((options & SIM_TAG_CONFIGURED) != 0U)
+		{
+			tag->cfg[SIM_TAG_RFA1SS] = 0x05U;
+			for (pwd = 0; pwd < 2U; pwd++)
+			{
+				ST_MEMCPY(tag->pwd[pwd], tagConfiguredPwd, SIM_TAG_PWD_LEN);
+			}
+		}
+	}
+}
+// END simTagsPlace
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagsField
+* Date             : 10/19/2026
+* Description      : Tells the tags the reader field went on or off. Without
+* 						the field the RF state is lost: the units go back to
+* 						Ready with their security sessions closed.
+*
+* Input Parameters : on, true while the field is on
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simTagsField
+void simTagsField(bool on)
+{
+	uint8_t i;
+
+	if (on)
+	{
+		return;
+	}
+
+	for (i = 0; i < tagCount; i++)
+	{
+		tags[i].state   = SIM_TAG_READY;
+		tags[i].session = SIM_TAG_NO_SESSION;
+		tags[i].slot    = SIM_TAG_NO_SLOT;
+	}
+}
+// END simTagsField
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagsRequest
+* Date             : 10/19/2026
+* Description      : Hands a request received by the tags to each of them.
+* 						A frame with a wrong CRC is ignored. An inventory is
+* 						answered by the units matching the mask, in slot 0
+* 						or, with 16 slots, in the slot of their next 4 UID
+* 						bits, each EOF alone moving to the next slot. Other
+* 						requests go to the unit addressed, to the selected
+* 						one, or to every unit not quiet.
+*
+* Input Parameters : frame, request bytes, CRC included
+* 					 len, bytes in frame, 0 for an EOF alone (next slot of
+* 						an inventory)
+* 					 replies, responses of the tags, SIM_TAG_MAX entries
+*
+* Return		   : number of tags answering
+*
+*****************************************************************************/
+
+// BEGIN simTagsRequest
+uint8_t simTagsRequest(const uint8_t *frame, uint16_t len, SimTagReply *replies)
+{
+	SimTag        *tag;
+	const uint8_t *uid = NULL;
+	uint8_t        answers = 0;
+	uint8_t        flags;
+	uint8_t        cmd;
+	uint8_t        param = 0;
+	uint8_t        maskLen;
+	uint16_t       pos = 2;
+	uint16_t       end;
+	uint8_t        i;
+
+	for (i = 0; i < tagCount; i++)
+	{
+		simTagIcm(&tags[i]);
+	}
+
+	// Next slot of a 16 slot inventory
+	if (len == 0U)
+	{
+		tagSlot++;
+		for (i = 0; i < tagCount; i++)
+		{
+			if (tags[i].slot == tagSlot)
+			{
+				tags[i].slot = SIM_TAG_NO_SLOT;
+				simTagInventoryReply(&tags[i], &replies[answers++]);
+			}
+		}
+		return answers;
+	}
+
+	if ((len < 4U) || (rfalCrcCalculateCcitt(0xFFFFU, frame, len) != SIM_TAG_CRC_RESIDUE))
+	{
+		return 0;
+	}
+	end   = (uint16_t)(len - RFAL_NFCV_CRC_LEN);
+	flags = frame[0];
+	cmd   = frame[1];
+
+	for (i = 0; i < tagCount; i++)
+	{
+		tags[i].slot = SIM_TAG_NO_SLOT;
+	}
+
+	if ((flags & (uint8_t)RFAL_NFCV_REQ_FLAG_INVENTORY) != 0U)
+	{
+		if ((cmd != (uint8_t)RFAL_NFCV_CMD_INVENTORY) || ((flags & (uint8_t)RFAL_NFCV_REQ_FLAG_AFI) != 0U) || (pos >= end))
+		{
+			return 0;
+		}
+		maskLen = frame[pos++];
+		if ((pos + ((maskLen + 7U) / 8U)) > end)
+		{
+			return 0;
+		}
+
+		tagSlot = 0;
+		for (i = 0; i < tagCount; i++)
+		{
+			tag = &tags[i];
+			if ((tag->state == SIM_TAG_QUIET) || !simTagMaskMatch(tag, maskLen, &frame[pos]))
+			{
+				continue;
+			}
+
+			tag->slot = (((flags & (uint8_t)RFAL_NFCV_REQ_FLAG_NB_SLOTS) != 0U) ? 0U : simTagSlotBits(tag, maskLen));
+			if (tag->slot == 0U)
+			{
+				tag->slot = SIM_TAG_NO_SLOT;
+				simTagInventoryReply(tag, &replies[answers++]);
+			}
+		}
+		return answers;
+	}
+
+	// IC manufacturer code of the ST commands, request field of the extended system information
+	if ((cmd >= (uint8_t)RFAL_NFCV_CMD_READ_CONFIGURATION) || (cmd == (uint8_t)RFAL_NFCV_CMD_EXTENDED_GET_SYS_INFO))
+	{
+		if ((pos >= end) || ((cmd >= (uint8_t)RFAL_NFCV_CMD_READ_CONFIGURATION) && (frame[pos] != RFAL_NFCV_ST_IC_MFG_CODE)))
+		{
+			return 0;
+		}
+		param = frame[pos++];
+	}
+	if ((flags & (uint8_t)RFAL_NFCV_REQ_FLAG_ADDRESS) != 0U)
+	{
+		uid  = &frame[pos];
+		pos += RFAL_NFCV_UID_LEN;
+	}
+	if (pos > end)
+	{
+		return 0;
+	}
+
+	for (i = 0; i < tagCount; i++)
+	{
+		tag = &tags[i];
+
+		if (uid != NULL)
+		{
+			if (memcmp(tag->uid, uid, RFAL_NFCV_UID_LEN) != 0)
+			{
+				// Another unit selected: the selected one goes back to Ready
+				if ((cmd == (uint8_t)RFAL_NFCV_CMD_SELECT) && (tag->state == SIM_TAG_SELECTED))
+				{
+					tag->state = SIM_TAG_READY;
+				}
+				continue;
+			}
+		}
+		else if ((flags & (uint8_t)RFAL_NFCV_REQ_FLAG_SELECT) != 0U)
+		{
+			if (tag->state != SIM_TAG_SELECTED)
+			{
+				continue;
+			}
+		}
+		else if (tag->state == SIM_TAG_QUIET)
+		{
+			continue;
+		}
+
+		replies[answers].len = 0;
+		simTagCommand(tag, flags, cmd, param, &frame[pos], (uint16_t)(end - pos), &replies[answers]);
+		if (replies[answers].len != 0U)
+		{
+			answers++;
+		}
+	}
+
+	return answers;
+}
+// END simTagsRequest
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagsRead
+* Date             : 10/19/2026
+* Description      : Reads the EEPROM of a unit in the field, for checks.
+*
+* Input Parameters : tag, unit index
+* 					 block, first block
+* 					 data, filled in
+* 					 len, bytes read
+*
+* Return		   : false if there is no such unit
+*
+*****************************************************************************/
+
+// BEGIN simTagsRead
+bool simTagsRead(uint8_t tag, uint16_t block, uint8_t *data, uint16_t len)
+{
+	uint32_t start = ((uint32_t)block * SIM_TAG_BLOCK_SIZE);
+
+	if ((tag >= tagCount) || ((start + len) > sizeof(tags[tag].mem)))
+	{
+		return false;
+	}
+
+	simTagIcm(&tags[tag]);
+	ST_MEMCPY(data, &tags[tag].mem[start], len);
+
+	return true;
+}
+// END simTagsRead
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagIcm
+* Date             : 10/19/2026
+* Description      : The ICM of the unit reads a message put by RF once its
+* 						time has come and stores it as its recipe, over I2C
+* 						so regardless of the RF protection.
+*
+* Input Parameters : tag, unit
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simTagIcm
+static void simTagIcm( SimTag *tag )
+{
+	uint32_t start = ((uint32_t)SIM_TAG_RECIPE_BLOCK * SIM_TAG_BLOCK_SIZE);
+
+	if ((tag->icmDue == 0U) || (simNow() < tag->icmDue))
+	{
+		return;
+	}
+
+	ST_MEMCPY(&tag->mem[start], tag->mb, MIN(tag->mbLen, (uint16_t)(sizeof(tag->mem) - start)));
+	tag->mbCtrl &= (uint8_t)~SIM_TAG_RF_PUT;
+	tag->mbLen   = 0;
+	tag->icmDue  = 0;
+}
+// END simTagIcm
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagMaskMatch / simTagSlotBits
+* Date             : 10/19/2026
+* Description      : Inventory mask check, least significant UID bit first,
+* 						and the slot of a 16 slot inventory: the 4 UID bits
+* 						following the mask.
+*
+*****************************************************************************/
+
+// BEGIN simTagMaskMatch
+static bool simTagMaskMatch( const SimTag *tag, uint8_t maskLen, const uint8_t *mask )
+{
+	uint8_t bit;
+
+	for (bit = 0; (bit < maskLen) && (bit < (RFAL_NFCV_UID_LEN * 8U)); bit++)
+	{
+		if ((((tag->uid[bit / 8U] ^ mask[bit / 8U]) >> (bit % 8U)) & 0x01U) != 0U)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+// END simTagMaskMatch
+
+// BEGIN simTagSlotBits
+static uint8_t simTagSlotBits( const SimTag *tag, uint8_t maskLen )
+{
+	uint8_t slot = 0;
+	uint8_t bit;
+	uint8_t pos;
+
+	for (bit = 0; bit < 4U; bit++)
+	{
+		pos = (uint8_t)(maskLen + bit);
+		if ((pos < (RFAL_NFCV_UID_LEN * 8U)) && (((tag->uid[pos / 8U] >> (pos % 8U)) & 0x01U) != 0U))
+		{
+			slot |= (uint8_t)(1U << bit);
+		}
+	}
+
+	return slot;
+}
+// END simTagSlotBits
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagInventoryReply
+* Date             : 10/19/2026
+* Description      : Inventory response: flags, DSFID and UID.
+*
+* Input Parameters : tag, unit answering
+* 					 reply, filled in
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simTagInventoryReply
+static void simTagInventoryReply( const SimTag *tag, SimTagReply *reply )
+{
+	reply->data[0] = 0x00U;
+	reply->data[1] = 0x00U;
+	ST_MEMCPY(&reply->data[2], tag->uid, RFAL_NFCV_UID_LEN);
+	reply->len     = (2U + RFAL_NFCV_UID_LEN);
+	reply->delayNs = SIM_TAG_T1_NS;
+	reply->fast    = false;
+
+	simTagFinish(reply);
+}
+// END simTagInventoryReply
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagCommand
+* Date             : 10/19/2026
+* Description      : Executes a request other than an inventory on a unit
+* 						it is meant for. Stay Quiet is the one request left
+* 						unanswered.
+*
+* Input Parameters : tag, unit
+* 					 flags, request flags
+* 					 cmd, command code
+* 					 param, IC manufacturer code or request field
+* 					 p, parameters after the UID
+* 					 n, bytes of parameters, CRC excluded
+* 					 reply, filled in, len left 0 for no response
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simTagCommand
+static void simTagCommand( SimTag *tag, uint8_t flags, uint8_t cmd, uint8_t param, const uint8_t *p, uint16_t n, SimTagReply *reply )
+{
+	uint16_t block;
+	uint16_t count;
+
+	reply->data[0] = 0x00U;
+	reply->len     = 1;
+	reply->delayNs = SIM_TAG_T1_NS;
+	reply->fast    = ((cmd & 0xF0U) == 0xC0U);    // ST fast commands answer at twice the data rate
+
+	switch (cmd)
+	{
+		case RFAL_NFCV_CMD_SLPV:
+			tag->state = SIM_TAG_QUIET;
+			reply->len = 0;
+			return;
+
+		case RFAL_NFCV_CMD_SELECT:
+			tag->state = SIM_TAG_SELECTED;
+			break;
+
+		case RFAL_NFCV_CMD_RESET_TO_READY:
+			tag->state = SIM_TAG_READY;
+			break;
+
+		case RFAL_NFCV_CMD_READ_SINGLE_BLOCK:
+		case RFAL_NFCV_CMD_FAST_READ_SINGLE_BLOCK:
+			if (n < 1U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			simTagRead(tag, flags, p[0], 1U, reply);
+			break;
+
+		case RFAL_NFCV_CMD_EXTENDED_READ_SINGLE_BLOCK:
+		case RFAL_NFCV_CMD_FAST_EXTENDED_READ_SINGLE_BLOCK:
+			if (n < 2U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			simTagRead(tag, flags, (uint16_t)(p[0] | ((uint16_t)p[1] << 8U)), 1U, reply);
+			break;
+
+		case RFAL_NFCV_CMD_READ_MULTIPLE_BLOCKS:
+		case RFAL_NFCV_CMD_FAST_READ_MULTIPLE_BLOCKS:
+			if (n < 2U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			simTagRead(tag, flags, p[0], (uint16_t)(p[1] + 1U), reply);
+			break;
+
+		case RFAL_NFCV_CMD_EXTENDED_READ_MULTIPLE_BLOCK:
+		case RFAL_NFCV_CMD_FAST_EXTENDED_READ_MULTIPLE_BLOCKS:
+			if (n < 4U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			simTagRead(tag, flags, (uint16_t)(p[0] | ((uint16_t)p[1] << 8U)), (uint16_t)((p[2] | ((uint16_t)p[3] << 8U)) + 1U), reply);
+			break;
+
+		case RFAL_NFCV_CMD_WRITE_SINGLE_BLOCK:
+			if (n < 1U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			simTagWrite(tag, p[0], 1U, &p[1], (uint16_t)(n - 1U), reply);
+			break;
+
+		case RFAL_NFCV_CMD_EXTENDED_WRITE_SINGLE_BLOCK:
+			if (n < 2U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			simTagWrite(tag, (uint16_t)(p[0] | ((uint16_t)p[1] << 8U)), 1U, &p[2], (uint16_t)(n - 2U), reply);
+			break;
+
+		case RFAL_NFCV_CMD_WRITE_MULTIPLE_BLOCKS:
+			if (n < 2U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			simTagWrite(tag, p[0], (uint16_t)(p[1] + 1U), &p[2], (uint16_t)(n - 2U), reply);
+			break;
+
+		case RFAL_NFCV_CMD_EXTENDED_WRITE_MULTIPLE_BLOCK:
+			if (n < 4U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			block = (uint16_t)(p[0] | ((uint16_t)p[1] << 8U));
+			count = (uint16_t)((p[2] | ((uint16_t)p[3] << 8U)) + 1U);
+			simTagWrite(tag, block, count, &p[4], (uint16_t)(n - 4U), reply);
+			break;
+
+		case RFAL_NFCV_CMD_GET_SYS_INFO:
+			simTagSysInfo(tag, (RFAL_NFCV_SYSINFO_DFSID | RFAL_NFCV_SYSINFO_AFI | RFAL_NFCV_SYSINFO_MEMSIZE | RFAL_NFCV_SYSINFO_ICREF), false, reply);
+			break;
+
+		case RFAL_NFCV_CMD_EXTENDED_GET_SYS_INFO:
+			simTagSysInfo(tag, param, true, reply);
+			break;
+
+		case RFAL_NFCV_CMD_READ_CONFIGURATION:
+			if ((n < 1U) || (p[0] >= SIM_TAG_CFG_REGS))
+			{
+				simTagError(reply, SIM_TAG_ERR_NOT_AVAILABLE);
+				break;
+			}
+			reply->data[reply->len++] = tag->cfg[p[0]];
+			break;
+
+		case RFAL_NFCV_CMD_WRITE_CONFIGURATION:
+			if ((n < 2U) || (p[0] >= SIM_TAG_CFG_REGS))
+			{
+				simTagError(reply, SIM_TAG_ERR_NOT_AVAILABLE);
+				break;
+			}
+			// Only with the configuration password presented
+			if (tag->session != 0U)
+			{
+				simTagError(reply, SIM_TAG_ERR_LOCKED);
+				break;
+			}
+			tag->cfg[p[0]]  = p[1];
+			reply->delayNs += SIM_TAG_CFG_NS;
+			break;
+
+		case RFAL_NFCV_CMD_PRESENT_PASSWORD:
+			if ((n < (1U + SIM_TAG_PWD_LEN)) || (p[0] >= SIM_TAG_PWDS))
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			// One session at a time, a wrong password closes the open one
+			if (memcmp(tag->pwd[p[0]], &p[1], SIM_TAG_PWD_LEN) != 0)
+			{
+				tag->session = SIM_TAG_NO_SESSION;
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			tag->session = p[0];
+			break;
+
+		case RFAL_NFCV_CMD_WRITE_PASSWORD:
+			if ((n < (1U + SIM_TAG_PWD_LEN)) || (p[0] >= SIM_TAG_PWDS) || (tag->session != p[0]))
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			ST_MEMCPY(tag->pwd[p[0]], &p[1], SIM_TAG_PWD_LEN);
+			reply->delayNs += SIM_TAG_PWD_NS;
+			break;
+
+		case RFAL_NFCV_CMD_READ_DYN_CONFIGURATION:
+		case RFAL_NFCV_CMD_FAST_READ_DYN_CONFIGURATION:
+			if (n < 1U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			reply->data[reply->len++] = ((p[0] == SIM_TAG_MB_CTRL_DYN) ? tag->mbCtrl : 0x00U);
+			break;
+
+		case RFAL_NFCV_CMD_WRITE_DYN_CONFIGURATION:
+		case RFAL_NFCV_CMD_FAST_WRITE_DYN_CONFIGURATION:
+			if (n < 2U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			if (p[0] != SIM_TAG_MB_CTRL_DYN)
+			{
+				break;
+			}
+			// The mailbox only turns on with MB_MODE set, turning it off drops the message
+			if ((p[1] & SIM_TAG_MB_EN) == 0U)
+			{
+				tag->mbCtrl = 0;
+				tag->mbLen  = 0;
+				tag->icmDue = 0;
+			}
+			else if (tag->cfg[SIM_TAG_MB_MODE] == 0U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+			}
+			else
+			{
+				tag->mbCtrl |= SIM_TAG_MB_EN;
+			}
+			break;
+
+		case RFAL_NFCV_CMD_WRITE_MESSAGE:
+		case RFAL_NFCV_CMD_FAST_WRITE_MESSAGE:
+			// The length goes on air minus one
+			if ((n < 2U) || ((uint16_t)(n - 1U) != (uint16_t)(p[0] + 1U)) ||
+			    ((tag->mbCtrl & SIM_TAG_MB_EN) == 0U) || ((tag->mbCtrl & (SIM_TAG_HOST_PUT | SIM_TAG_RF_PUT)) != 0U))
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			tag->mbLen   = (uint16_t)(p[0] + 1U);
+			ST_MEMCPY(tag->mb, &p[1], tag->mbLen);
+			tag->mbCtrl |= SIM_TAG_RF_PUT;
+			tag->icmDue  = (simNow() + SIM_TAG_ICM_NS);
+			break;
+
+		case RFAL_NFCV_CMD_READ_MESSAGE_LENGTH:
+		case RFAL_NFCV_CMD_FAST_READ_MESSAGE_LENGTH:
+			if (tag->mbLen == 0U)
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			reply->data[reply->len++] = (uint8_t)(tag->mbLen - 1U);
+			break;
+
+		case RFAL_NFCV_CMD_READ_MESSAGE:
+		case RFAL_NFCV_CMD_FAST_READ_MESSAGE:
+			if ((n < 2U) || (((uint16_t)p[0] + p[1] + 1U) > tag->mbLen))
+			{
+				simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+				break;
+			}
+			ST_MEMCPY(&reply->data[1], &tag->mb[p[0]], (uint16_t)(p[1] + 1U));
+			reply->len = (uint16_t)(reply->len + p[1] + 1U);
+			break;
+
+		default:
+			simTagError(reply, SIM_TAG_ERR_NOT_SUPPORTED);
+			break;
+	}
+
+	simTagFinish(reply);
+}
+// END simTagCommand
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagRead
+* Date             : 10/19/2026
+* Description      : Read Single or Multiple Blocks response, with the block
+* 						security status before each block when the option
+* 						flag asks for it.
+*
+* Input Parameters : tag, unit
+* 					 flags, request flags
+* 					 block, first block
+* 					 count, blocks to read
+* 					 reply, filled in
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simTagRead
+static void simTagRead( SimTag *tag, uint8_t flags, uint16_t block, uint16_t count, SimTagReply *reply )
+{
+	bool     option = ((flags & (uint8_t)RFAL_NFCV_REQ_FLAG_OPTION) != 0U);
+	uint16_t i;
+
+	if (((uint32_t)block + count) > SIM_TAG_BLOCKS)
+	{
+		simTagError(reply, SIM_TAG_ERR_NOT_AVAILABLE);
+		return;
+	}
+	if (!simTagCanRead(tag))
+	{
+		simTagError(reply, SIM_TAG_ERR_READ_DENIED);
+		return;
+	}
+	if ((1U + ((uint32_t)count * (SIM_TAG_BLOCK_SIZE + (option ? 1U : 0U))) + RFAL_NFCV_CRC_LEN) > SIM_TAG_REPLY_LEN)
+	{
+		simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+		return;
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		if (option)
+		{
+			reply->data[reply->len++] = 0x00U;
+		}
+		ST_MEMCPY(&reply->data[reply->len], &tag->mem[(uint32_t)(block + i) * SIM_TAG_BLOCK_SIZE], SIM_TAG_BLOCK_SIZE);
+		reply->len = (uint16_t)(reply->len + SIM_TAG_BLOCK_SIZE);
+	}
+}
+// END simTagRead
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagWrite
+* Date             : 10/19/2026
+* Description      : Write Single or Multiple Blocks: the response comes once
+* 						every block is programmed.
+*
+* Input Parameters : tag, unit
+* 					 block, first block
+* 					 count, blocks to write
+* 					 data, block data
+* 					 n, bytes of data
+* 					 reply, filled in
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simTagWrite
+static void simTagWrite( SimTag *tag, uint16_t block, uint16_t count, const uint8_t *data, uint16_t n, SimTagReply *reply )
+{
+	if ((count > SIM_TAG_WRITE_BLOCKS) || (n != (count * SIM_TAG_BLOCK_SIZE)))
+	{
+		simTagError(reply, SIM_TAG_ERR_UNKNOWN);
+		return;
+	}
+	if (((uint32_t)block + count) > SIM_TAG_BLOCKS)
+	{
+		simTagError(reply, SIM_TAG_ERR_NOT_AVAILABLE);
+		return;
+	}
+	if (!simTagCanWrite(tag))
+	{
+		simTagError(reply, SIM_TAG_ERR_LOCKED);
+		return;
+	}
+
+	ST_MEMCPY(&tag->mem[(uint32_t)block * SIM_TAG_BLOCK_SIZE], data, n);
+	reply->delayNs += ((uint32_t)count * SIM_TAG_WRITE_NS);
+}
+// END simTagWrite
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagSysInfo
+* Date             : 10/19/2026
+* Description      : Get System Information response, or the extended one
+* 						with the fields asked and a 16 bit block count.
+*
+* Input Parameters : tag, unit
+* 					 request, RFAL_NFCV_SYSINFO_xxx fields asked
+* 					 extended, true for Extended Get System Information
+* 					 reply, filled in
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simTagSysInfo
+static void simTagSysInfo( const SimTag *tag, uint8_t request, bool extended, SimTagReply *reply )
+{
+	uint8_t info = (uint8_t)(request & (RFAL_NFCV_SYSINFO_DFSID | RFAL_NFCV_SYSINFO_AFI | RFAL_NFCV_SYSINFO_MEMSIZE | RFAL_NFCV_SYSINFO_ICREF));
+
+	reply->data[reply->len++] = info;
+	ST_MEMCPY(&reply->data[reply->len], tag->uid, RFAL_NFCV_UID_LEN);
+	reply->len = (uint16_t)(reply->len + RFAL_NFCV_UID_LEN);
+
+	if ((info & RFAL_NFCV_SYSINFO_DFSID) != 0U)
+	{
+		reply->data[reply->len++] = 0x00U;
+	}
+	if ((info & RFAL_NFCV_SYSINFO_AFI) != 0U)
+	{
+		reply->data[reply->len++] = 0x00U;
+	}
+	if ((info & RFAL_NFCV_SYSINFO_MEMSIZE) != 0U)
+	{
+		reply->data[reply->len++] = (uint8_t)((SIM_TAG_BLOCKS - 1U) & 0xFFU);
+		if (extended)
+		{
+			reply->data[reply->len++] = (uint8_t)((SIM_TAG_BLOCKS - 1U) >> 8U);
+		}
+		reply->data[reply->len++] = (uint8_t)(SIM_TAG_BLOCK_SIZE - 1U);
+	}
+	if ((info & RFAL_NFCV_SYSINFO_ICREF) != 0U)
+	{
+		reply->data[reply->len++] = SIM_TAG_IC_REF;
+	}
+}
+// END simTagSysInfo
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagCanRead / simTagCanWrite
+* Date             : 10/19/2026
+* Description      : Area 1 access from RFA1SS: PWD_CTRL_A1 names the
+* 						password, RW_PROTECTION_A1 what it guards. 00 leaves
+* 						the area open, 01 guards writes, 10 reads and
+* 						writes, 11 reads with writes forbidden.
+*
+*****************************************************************************/
+
+// BEGIN simTagCanRead
+static bool simTagCanRead( const SimTag *tag )
+{
+	uint8_t rw  = (uint8_t)((tag->cfg[SIM_TAG_RFA1SS] >> 2U) & 0x03U);
+	uint8_t pwd = (uint8_t)(tag->cfg[SIM_TAG_RFA1SS] & 0x03U);
+
+	return ((rw < 2U) || ((pwd != 0U) && (tag->session == pwd)));
+}
+// END simTagCanRead
+
+// BEGIN simTagCanWrite
+static bool simTagCanWrite( const SimTag *tag )
+{
+	uint8_t rw  = (uint8_t)((tag->cfg[SIM_TAG_RFA1SS] >> 2U) & 0x03U);
+	uint8_t pwd = (uint8_t)(tag->cfg[SIM_TAG_RFA1SS] & 0x03U);
+
+	return ((rw == 0U) || ((rw < 3U) && (pwd != 0U) && (tag->session == pwd)));
+}
+// END simTagCanWrite
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simTagError / simTagFinish
+* Date             : 10/19/2026
+* Description      : Error response with its code, and the CRC appended to
+* 						a response, complemented and least significant byte
+* 						first.
+*
+*****************************************************************************/
+
+// BEGIN simTagError
+static void simTagError( SimTagReply *reply, uint8_t code )
+{
+	reply->data[0] = (uint8_t)RFAL_NFCV_RES_FLAG_ERROR;
+	reply->data[1] = code;
+	reply->len     = 2;
+}
+// END simTagError
+
+// BEGIN simTagFinish
+static void simTagFinish( SimTagReply *reply )
+{
+	uint16_t crc = (uint16_t)~rfalCrcCalculateCcitt(0xFFFFU, reply->data, reply->len);
+
+	reply->data[reply->len++] = (uint8_t)(crc & 0xFFU);
+	reply->data[reply->len++] = (uint8_t)(crc >> 8U);
+}
+// END simTagFinish
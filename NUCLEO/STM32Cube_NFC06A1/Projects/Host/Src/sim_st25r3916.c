@@ -0,0 +1,1396 @@
+/*********************************************************************************
+* File Name :	sim_st25r3916.c
+* Description: ST25R3916 model implementation file
+*		          Decodes the SPI cycles of the driver into register,
+*		          FIFO and direct command accesses and plays what the chip
+*		          does on its own as timed events: oscillator start,
+*		          collision avoidance, measurements, the GPT and the NRT,
+*		          the transmission of the FIFO and the reception of the
+*		          tag responses. Only what RFAL reads back is modelled;
+*		          analog settings are stored and otherwise ignored.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "sim_st25r3916.h"
+#include "sim_st25dv.h"
+#include "st25r3916.h"
+#include "st25r3916_com.h"
+#include "st25r3916_irq.h"
+#include "utils.h"
+#include <string.h>
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define SIM_CHIP_REGS        64U            // registers in each space
+#define SIM_CHIP_IDENTITY    0x2AU          // ST25R3916, revision 2
+#define SIM_CHIP_VDD         141U           // AD_RESULT of MEASURE_VDD, 3.3 V
+#define SIM_CHIP_AMPLITUDE   0x7CU          // AD_RESULT of the other measurements
+#define SIM_CHIP_REGULATOR   0x90U          // REGULATOR_RESULT of ADJUST_REGULATORS
+
+#define SIM_CHIP_FC_NS(n)    (((uint64_t)(n) * 1000000000ULL) / 13560000ULL)   // n carrier periods
+#define SIM_CHIP_OSC_NS      700000U        // oscillator start up
+#define SIM_CHIP_APON_NS     100000U        // initial collision avoidance until the field is on
+#define SIM_CHIP_CAT_NS      75000U         // field on guard time, FIELD_ON_GT 0
+#define SIM_CHIP_DCT_NS      100000U        // measurements and calibrations
+#define SIM_CHIP_ETU_BYTES   10U            // etu of one byte of the framed technologies, start and stop bits
+
+#define SIM_CHIP_FIFO_WL_TX  200U           // FIFO level raising the water level interrupt while transmitting
+#define SIM_CHIP_FIFO_WL_RX  300U           // FIFO level raising it while receiving
+#define SIM_CHIP_TX_LOG      4096U          // coded bytes of one transmitted frame kept for decoding
+#define SIM_CHIP_SOF_BITS    5U             // stream bits of the response SOF
+#define SIM_CHIP_EOF_BITS    8U             // stream bits of the response EOF
+#define SIM_CHIP_STREAM_LEN  ((((SIM_TAG_REPLY_LEN * 16U) + SIM_CHIP_SOF_BITS + SIM_CHIP_EOF_BITS) + 7U) / 8U)
+
+#define SIM_CHIP_VCD_SOF4    0x21U          // SOF of a 1 out of 4 frame
+#define SIM_CHIP_VCD_SOF256  0x81U          // SOF of a 1 out of 256 frame
+#define SIM_CHIP_VCD_EOF     0x04U          // EOF of both
+
+// Chip events, each with its own due time
+typedef enum
+{
+	SIM_EV_OSC,                             // oscillator stable
+	SIM_EV_CA,                              // collision avoidance step
+	SIM_EV_DCT,                             // direct command terminated
+	SIM_EV_GPT,                             // general purpose timer expired
+	SIM_EV_NRT,                             // no response timer expired
+	SIM_EV_TX,                              // FIFO water level or end of transmission
+	SIM_EV_RX,                              // start, water level or end of reception
+	SIM_EV_COUNT
+} SimChipEvent;
+
+// State of the current SPI chip select cycle
+typedef enum
+{
+	SIM_SPI_IDLE,                           // waiting for the first byte
+	SIM_SPI_PREFIX,                         // space B or test access, waiting for the register byte
+	SIM_SPI_WRITE,                          // register write, address incremented
+	SIM_SPI_READ,                           // register read, address incremented
+	SIM_SPI_FIFO_LOAD,                      // bytes into the FIFO
+	SIM_SPI_FIFO_READ,                      // bytes out of the FIFO
+	SIM_SPI_IGNORE                          // direct command or passive target memory, rest ignored
+} SimSpiState;
+
+// Register spaces
+typedef enum
+{
+	SIM_SPACE_A,
+	SIM_SPACE_B,
+	SIM_SPACE_TEST
+} SimSpace;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static uint8_t  chipReg[3][SIM_CHIP_REGS];  // space A, space B and test registers
+static uint32_t chipIrq;                    // latched interrupts, read and cleared through the IRQ registers
+static uint64_t chipDue[SIM_EV_COUNT];      // due time of each event, SIM_CHIP_NO_EVENT if idle
+static uint64_t chipNow;                    // time of the last simChipRun
+static bool     chipOscOk;                  // oscillator stable
+static uint8_t  chipCaStep;                 // collision avoidance: 0 field coming on, 1 guard time
+static SimChipStats chipStats;
+
+static SimSpiState spiState;
+static SimSpace    spiSpace;
+static uint8_t     spiReg;                  // next register accessed
+
+static uint8_t  fifo[ST25R3916_FIFO_DEPTH];
+static uint16_t fifoHead;                   // next byte out
+static uint16_t fifoCount;                  // bytes in the FIFO
+
+static bool     txActive;                   // transmission running
+static bool     txStream;                   // NFC-V subcarrier stream mode
+static bool     txFwl;                      // water level raised since the last load
+static uint64_t txStart;                    // first byte on air
+static uint32_t txByteNs;                   // time of one FIFO byte on air
+static uint16_t txExpected;                 // FIFO bytes of the frame, NUM_TX_BYTES
+static uint16_t txLoaded;                   // FIFO bytes of the frame loaded so far
+static uint8_t  txLog[SIM_CHIP_TX_LOG];     // FIFO bytes of the frame
+static uint8_t  txFrame[SIM_CHIP_TX_LOG / 4U];  // decoded request
+
+static SimTagReply rxReplies[SIM_TAG_MAX];
+static uint8_t  rxStream[SIM_CHIP_STREAM_LEN];
+static uint16_t rxLen;                      // stream bytes of the response
+static uint16_t rxPushed;                   // stream bytes already in the FIFO
+static bool     rxActive;                   // response on its way or being received
+static bool     rxStarted;                  // RXS raised
+static bool     rxFwl;                      // water level raised since the last read
+static uint64_t rxStart;                    // start of the response SOF
+static uint64_t rxEnd;                      // end of the response EOF
+static uint32_t rxBitNs;                    // time of one stream bit
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static void     simChipDefault( void );
+static void     simChipSpiByte( uint8_t mosi, uint8_t *miso );
+static void     simChipCommand( uint8_t cmd );
+static uint8_t  simChipReadReg( SimSpace space, uint8_t reg );
+static void     simChipWriteReg( SimSpace space, uint8_t reg, uint8_t value );
+static void     simChipField( bool on );
+static uint32_t simChipMask( void );
+static uint64_t simChipNrtNs( void );
+static void     simChipFifoPush( uint8_t byte );
+static uint8_t  simChipFifoPop( void );
+static void     simChipTxStart( void );
+static void     simChipTxEvent( void );
+static void     simChipTxSchedule( void );
+static void     simChipTxEnd( void );
+static bool     simChipDecodeVcd( uint16_t *frameLen );
+static void     simChipRxEncode( const SimTagReply *reply );
+static void     simChipRxEvent( void );
+static void     simChipRxSchedule( void );
+static void     simChipStop( void );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipInit
+* Date             : 10/19/2026
+* Description      : Powers the chip up in its default state.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipInit
+void simChipInit(void)
+{
+	chipNow  = 0;
+	spiState = SIM_SPI_IDLE;
+	ST_MEMSET(&chipStats, 0, sizeof(chipStats));
+	ST_MEMSET(chipReg, 0, sizeof(chipReg));
+
+	simChipDefault();
+}
+// END simChipInit
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipSelect
+* Date             : 10/19/2026
+* Description      : Chip select: a falling edge starts an SPI transaction,
+* 						a rising edge ends it.
+*
+* Input Parameters : active, true while the chip select is low
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipSelect
+void simChipSelect(bool active)
+{
+	spiState = SIM_SPI_IDLE;
+	spiSpace = SIM_SPACE_A;
+}
+// END simChipSelect
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipSpi
+* Date             : 10/19/2026
+* Description      : Clocks bytes through the SPI of the chip.
+*
+* Input Parameters : tx, bytes into MOSI
+* 					 rx, bytes out of MISO
+* 					 len, bytes clocked
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipSpi
+void simChipSpi(const uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+	uint16_t i;
+
+	for (i = 0; i < len; i++)
+	{
+		rx[i] = 0;
+		simChipSpiByte(tx[i], &rx[i]);
+	}
+
+	// The FIFO moved: new water level and end of frame times
+	if (spiState == SIM_SPI_FIFO_LOAD)
+	{
+		simChipTxSchedule();
+	}
+	else if (spiState == SIM_SPI_FIFO_READ)
+	{
+		simChipRxSchedule();
+	}
+}
+// END simChipSpi
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipIrq
+* Date             : 10/19/2026
+* Description      : Level of the interrupt line: high while an interrupt
+* 						not masked is pending.
+*
+* Input Parameters : none
+*
+* Return		   : true if the line is high
+*
+*****************************************************************************/
+
+// BEGIN simChipIrq
+bool simChipIrq(void)
+{
+	return ((chipIrq & ~simChipMask()) != 0U);
+}
+// END simChipIrq
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipNextEvent
+* Date             : 10/19/2026
+* Description      : Time of the next thing the chip does on its own.
+*
+* Input Parameters : none
+*
+* Return		   : time in ns, SIM_CHIP_NO_EVENT if none is pending
+*
+*****************************************************************************/
+
+// BEGIN simChipNextEvent
+uint64_t simChipNextEvent(void)
+{
+	uint64_t next = SIM_CHIP_NO_EVENT;
+	uint8_t  ev;
+
+	for (ev = 0; ev < (uint8_t)SIM_EV_COUNT; ev++)
+	{
+		next = MIN(next, chipDue[ev]);
+	}
+
+	return next;
+}
+// END simChipNextEvent
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipRun
+* Date             : 10/19/2026
+* Description      : Runs the events due by the given time, in order. An
+* 						event runs at its own due time, so what it schedules
+* 						is timed from there.
+*
+* Input Parameters : now, current time in ns
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipRun
+void simChipRun(uint64_t now)
+{
+	SimChipEvent ev;
+	uint8_t      i;
+
+	for (;;)
+	{
+		ev = SIM_EV_COUNT;
+		for (i = 0; i < (uint8_t)SIM_EV_COUNT; i++)
+		{
+			if ((chipDue[i] <= now) && ((ev == SIM_EV_COUNT) || (chipDue[i] < chipDue[ev])))
+			{
+				ev = (SimChipEvent)i;
+			}
+		}
+		if (ev == SIM_EV_COUNT)
+		{
+			break;
+		}
+
+		chipNow     = MAX(chipNow, chipDue[ev]);
+		chipDue[ev] = SIM_CHIP_NO_EVENT;
+
+		switch (ev)
+		{
+			case SIM_EV_OSC:
+				chipOscOk = true;
+				chipIrq  |= ST25R3916_IRQ_MASK_OSC;
+				break;
+
+			case SIM_EV_CA:
+				if (chipCaStep == 0U)
+				{
+					simChipWriteReg(SIM_SPACE_A, ST25R3916_REG_OP_CONTROL, (uint8_t)(chipReg[SIM_SPACE_A][ST25R3916_REG_OP_CONTROL] | ST25R3916_REG_OP_CONTROL_tx_en));
+					chipIrq          |= ST25R3916_IRQ_MASK_APON;
+					chipCaStep        = 1U;
+					chipDue[SIM_EV_CA] = (chipNow + SIM_CHIP_CAT_NS);
+				}
+				else
+				{
+					chipIrq |= ST25R3916_IRQ_MASK_CAT;
+				}
+				break;
+
+			case SIM_EV_DCT:
+				chipIrq |= ST25R3916_IRQ_MASK_DCT;
+				break;
+
+			case SIM_EV_GPT:
+				chipIrq |= ST25R3916_IRQ_MASK_GPE;
+				break;
+
+			case SIM_EV_NRT:
+				chipIrq |= ST25R3916_IRQ_MASK_NRE;
+				break;
+
+			case SIM_EV_TX:
+				simChipTxEvent();
+				break;
+
+			case SIM_EV_RX:
+			default:
+				simChipRxEvent();
+				break;
+		}
+	}
+
+	chipNow = MAX(chipNow, now);
+}
+// END simChipRun
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipGetStats
+* Date             : 10/19/2026
+* Description      : RF traffic since simChipInit.
+*
+* Input Parameters : stats, filled in
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipGetStats
+void simChipGetStats(SimChipStats *stats)
+{
+	*stats = chipStats;
+}
+// END simChipGetStats
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipDefault
+* Date             : 10/19/2026
+* Description      : SET_DEFAULT: registers back to their reset value, every
+* 						activity stopped, oscillator and field off. The
+* 						interrupt masks reset to 0, all sources enabled.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipDefault
+static void simChipDefault( void )
+{
+	uint8_t ev;
+
+	simChipField(false);
+	ST_MEMSET(chipReg[SIM_SPACE_A], 0, SIM_CHIP_REGS);
+	ST_MEMSET(chipReg[SIM_SPACE_B], 0, SIM_CHIP_REGS);
+
+	for (ev = 0; ev < (uint8_t)SIM_EV_COUNT; ev++)
+	{
+		chipDue[ev] = SIM_CHIP_NO_EVENT;
+	}
+	chipIrq   = 0;
+	chipOscOk = false;
+	fifoHead  = 0;
+	fifoCount = 0;
+	txActive  = false;
+	rxActive  = false;
+	rxStarted = false;
+}
+// END simChipDefault
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipSpiByte
+* Date             : 10/19/2026
+* Description      : One byte of the SPI cycle. The first byte selects the
+* 						access: a direct command (top bits 11), a space B or
+* 						test access prefix, a FIFO load or read, the passive
+* 						target memory, or a register write (00) or read (01)
+* 						from the given address on.
+*
+* Input Parameters : mosi, byte from the MCU
+* 					 miso, byte to the MCU
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipSpiByte
+static void simChipSpiByte( uint8_t mosi, uint8_t *miso )
+{
+	switch (spiState)
+	{
+		case SIM_SPI_IDLE:
+			if (mosi == ST25R3916_CMD_SPACE_B_ACCESS)
+			{
+				spiSpace = SIM_SPACE_B;
+				spiState = SIM_SPI_PREFIX;
+			}
+			else if (mosi == ST25R3916_CMD_TEST_ACCESS)
+			{
+				spiSpace = SIM_SPACE_TEST;
+				spiState = SIM_SPI_PREFIX;
+			}
+			else if ((mosi & 0xC0U) == 0xC0U)
+			{
+				simChipCommand(mosi);
+				spiState = SIM_SPI_IGNORE;
+			}
+			else if (mosi == 0x80U)
+			{
+				spiState = SIM_SPI_FIFO_LOAD;
+			}
+			else if (mosi == 0x9FU)
+			{
+				spiState = SIM_SPI_FIFO_READ;
+			}
+			else if ((mosi & 0xC0U) == 0x80U)
+			{
+				spiState = SIM_SPI_IGNORE;          // passive target memory, listen mode only
+			}
+			else
+			{
+				spiReg   = (uint8_t)(mosi & 0x3FU);
+				spiState = (((mosi & 0x40U) != 0U) ? SIM_SPI_READ : SIM_SPI_WRITE);
+			}
+			break;
+
+		case SIM_SPI_PREFIX:
+			spiReg   = (uint8_t)(mosi & 0x3FU);
+			spiState = (((mosi & 0x40U) != 0U) ? SIM_SPI_READ : SIM_SPI_WRITE);
+			break;
+
+		case SIM_SPI_WRITE:
+			simChipWriteReg(spiSpace, spiReg, mosi);
+			spiReg = (uint8_t)((spiReg + 1U) & 0x3FU);
+			break;
+
+		case SIM_SPI_READ:
+			*miso  = simChipReadReg(spiSpace, spiReg);
+			spiReg = (uint8_t)((spiReg + 1U) & 0x3FU);
+			break;
+
+		case SIM_SPI_FIFO_LOAD:
+			if (txActive)
+			{
+				// Straight to the frame on air, the level is tracked by time
+				if (txLoaded < SIM_CHIP_TX_LOG)
+				{
+					txLog[txLoaded] = mosi;
+				}
+				txLoaded++;
+				txFwl = false;
+			}
+			else
+			{
+				simChipFifoPush(mosi);
+			}
+			break;
+
+		case SIM_SPI_FIFO_READ:
+			*miso = simChipFifoPop();
+			break;
+
+		case SIM_SPI_IGNORE:
+		default:
+			break;
+	}
+}
+// END simChipSpiByte
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipCommand
+* Date             : 10/19/2026
+* Description      : Executes a direct command. Commands the firmware does
+* 						not rely on are accepted and do nothing.
+*
+* Input Parameters : cmd, direct command code
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipCommand
+static void simChipCommand( uint8_t cmd )
+{
+	uint16_t gpt;
+	uint64_t nrt;
+
+	switch (cmd)
+	{
+		case ST25R3916_CMD_SET_DEFAULT:
+			simChipDefault();
+			break;
+
+		case ST25R3916_CMD_STOP:
+			simChipStop();
+			break;
+
+		case ST25R3916_CMD_CLEAR_FIFO:
+			fifoHead  = 0;
+			fifoCount = 0;
+			break;
+
+		case ST25R3916_CMD_TRANSMIT_WITH_CRC:
+		case ST25R3916_CMD_TRANSMIT_WITHOUT_CRC:
+			simChipTxStart();
+			break;
+
+		case ST25R3916_CMD_INITIAL_RF_COLLISION:
+			// No other field around: the field comes on, then the guard time
+			chipCaStep        = 0;
+			chipDue[SIM_EV_CA] = (chipNow + SIM_CHIP_APON_NS);
+			break;
+
+		case ST25R3916_CMD_MEASURE_VDD:
+			chipReg[SIM_SPACE_A][ST25R3916_REG_AD_RESULT] = SIM_CHIP_VDD;
+			chipDue[SIM_EV_DCT] = (chipNow + SIM_CHIP_DCT_NS);
+			break;
+
+		case ST25R3916_CMD_ADJUST_REGULATORS:
+			chipReg[SIM_SPACE_B][ST25R3916_REG_REGULATOR_RESULT & ~ST25R3916_SPACE_B] = SIM_CHIP_REGULATOR;
+			chipDue[SIM_EV_DCT] = (chipNow + SIM_CHIP_DCT_NS);
+			break;
+
+		case ST25R3916_CMD_MEASURE_AMPLITUDE:
+		case ST25R3916_CMD_MEASURE_PHASE:
+		case ST25R3916_CMD_MEASURE_CAPACITANCE:
+		case ST25R3916_CMD_CALIBRATE_C_SENSOR:
+		case ST25R3916_CMD_CALIBRATE_DRIVER_TIMING:
+			chipReg[SIM_SPACE_A][ST25R3916_REG_AD_RESULT] = SIM_CHIP_AMPLITUDE;
+			chipDue[SIM_EV_DCT] = (chipNow + SIM_CHIP_DCT_NS);
+			break;
+
+		case ST25R3916_CMD_START_GP_TIMER:
+			gpt = (uint16_t)(((uint16_t)chipReg[SIM_SPACE_A][ST25R3916_REG_GPT1] << 8U) | chipReg[SIM_SPACE_A][ST25R3916_REG_GPT2]);
+			chipDue[SIM_EV_GPT] = (chipNow + SIM_CHIP_FC_NS(8U * (uint32_t)gpt));
+			break;
+
+		case ST25R3916_CMD_START_NO_RESPONSE_TIMER:
+			nrt = simChipNrtNs();
+			chipDue[SIM_EV_NRT] = ((nrt != 0U) ? (chipNow + nrt) : SIM_CHIP_NO_EVENT);
+			break;
+
+		case ST25R3916_CMD_STOP_NRT:
+			chipDue[SIM_EV_NRT] = SIM_CHIP_NO_EVENT;
+			break;
+
+		default:
+			break;
+	}
+}
+// END simChipCommand
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipReadReg
+* Date             : 10/19/2026
+* Description      : Register read. The interrupt registers clear on read,
+* 						the status and display registers show the live state.
+*
+* Input Parameters : space, register space
+* 					 reg, address in the space
+*
+* Return		   : register value
+*
+*****************************************************************************/
+
+// BEGIN simChipReadReg
+static uint8_t simChipReadReg( SimSpace space, uint8_t reg )
+{
+	uint8_t value;
+	uint8_t shift;
+
+	if (space != SIM_SPACE_A)
+	{
+		return chipReg[space][reg];
+	}
+
+	switch (reg)
+	{
+		case ST25R3916_REG_IRQ_MAIN:
+		case ST25R3916_REG_IRQ_TIMER_NFC:
+		case ST25R3916_REG_IRQ_ERROR_WUP:
+		case ST25R3916_REG_IRQ_TARGET:
+			shift   = (uint8_t)((reg - ST25R3916_REG_IRQ_MAIN) * 8U);
+			value   = (uint8_t)(chipIrq >> shift);
+			chipIrq &= ~((uint32_t)0xFFU << shift);
+			break;
+
+		case ST25R3916_REG_FIFO_STATUS1:
+			value = (uint8_t)(fifoCount & 0xFFU);
+			break;
+
+		case ST25R3916_REG_FIFO_STATUS2:
+			value = (uint8_t)(((fifoCount >> 8U) << ST25R3916_REG_FIFO_STATUS2_fifo_b_shift) & ST25R3916_REG_FIFO_STATUS2_fifo_b_mask);
+			break;
+
+		case ST25R3916_REG_NFCIP1_BIT_RATE:
+			value  = ((chipDue[SIM_EV_GPT] != SIM_CHIP_NO_EVENT) ? ST25R3916_REG_NFCIP1_BIT_RATE_gpt_on : 0U);
+			value |= ((chipDue[SIM_EV_NRT] != SIM_CHIP_NO_EVENT) ? ST25R3916_REG_NFCIP1_BIT_RATE_nrt_on : 0U);
+			break;
+
+		case ST25R3916_REG_AUX_DISPLAY:
+			value  = (chipOscOk ? ST25R3916_REG_AUX_DISPLAY_osc_ok : 0U);
+			value |= (((chipReg[SIM_SPACE_A][ST25R3916_REG_OP_CONTROL] & ST25R3916_REG_OP_CONTROL_tx_en) != 0U) ? ST25R3916_REG_AUX_DISPLAY_tx_on : 0U);
+			value |= (((chipReg[SIM_SPACE_A][ST25R3916_REG_OP_CONTROL] & ST25R3916_REG_OP_CONTROL_rx_en) != 0U) ? ST25R3916_REG_AUX_DISPLAY_rx_on : 0U);
+			value |= (rxStarted ? ST25R3916_REG_AUX_DISPLAY_rx_act : 0U);
+			break;
+
+		case ST25R3916_REG_IC_IDENTITY:
+			value = SIM_CHIP_IDENTITY;
+			break;
+
+		default:
+			value = chipReg[SIM_SPACE_A][reg];
+			break;
+	}
+
+	return value;
+}
+// END simChipReadReg
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipWriteReg
+* Date             : 10/19/2026
+* Description      : Register write. Read only registers keep their value;
+* 						the operation control starts the oscillator and
+* 						switches the field.
+*
+* Input Parameters : space, register space
+* 					 reg, address in the space
+* 					 value, value written
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipWriteReg
+static void simChipWriteReg( SimSpace space, uint8_t reg, uint8_t value )
+{
+	uint8_t old;
+
+	reg &= (uint8_t)(SIM_CHIP_REGS - 1U);
+	old  = chipReg[space][reg];
+
+	if (space != SIM_SPACE_A)
+	{
+		chipReg[space][reg] = value;
+		return;
+	}
+
+	if (((reg >= ST25R3916_REG_IRQ_MAIN) && (reg <= ST25R3916_REG_FIFO_STATUS2)) || (reg == ST25R3916_REG_NFCIP1_BIT_RATE) ||
+	    (reg == ST25R3916_REG_AD_RESULT) || (reg == ST25R3916_REG_AUX_DISPLAY) || (reg == ST25R3916_REG_IC_IDENTITY))
+	{
+		return;
+	}
+	chipReg[SIM_SPACE_A][reg] = value;
+
+	if (reg == ST25R3916_REG_OP_CONTROL)
+	{
+		if (((value & ST25R3916_REG_OP_CONTROL_en) != 0U) && ((old & ST25R3916_REG_OP_CONTROL_en) == 0U))
+		{
+			chipDue[SIM_EV_OSC] = (chipNow + SIM_CHIP_OSC_NS);
+		}
+		else if ((value & ST25R3916_REG_OP_CONTROL_en) == 0U)
+		{
+			chipOscOk           = false;
+			chipDue[SIM_EV_OSC] = SIM_CHIP_NO_EVENT;
+		}
+
+		if ((value & ST25R3916_REG_OP_CONTROL_tx_en) != (old & ST25R3916_REG_OP_CONTROL_tx_en))
+		{
+			simChipField((value & ST25R3916_REG_OP_CONTROL_tx_en) != 0U);
+		}
+	}
+}
+// END simChipWriteReg
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipField
+* Date             : 10/19/2026
+* Description      : The field went on or off: the tags are told, a
+* 						transmission or reception going on is lost.
+*
+* Input Parameters : on, true for field on
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipField
+static void simChipField( bool on )
+{
+	if (!on)
+	{
+		rxActive  = false;
+		rxStarted = false;
+		chipDue[SIM_EV_RX] = SIM_CHIP_NO_EVENT;
+	}
+
+	simTagsField(on);
+}
+// END simChipField
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipMask
+* Date             : 10/19/2026
+* Description      : The four interrupt mask registers as one word, in the
+* 						bit order of the interrupt registers.
+*
+* Input Parameters : none
+*
+* Return		   : mask, 1 for a source kept off the line
+*
+*****************************************************************************/
+
+// BEGIN simChipMask
+static uint32_t simChipMask( void )
+{
+	return ( (uint32_t)chipReg[SIM_SPACE_A][ST25R3916_REG_IRQ_MASK_MAIN]
+	       | ((uint32_t)chipReg[SIM_SPACE_A][ST25R3916_REG_IRQ_MASK_TIMER_NFC] << 8U)
+	       | ((uint32_t)chipReg[SIM_SPACE_A][ST25R3916_REG_IRQ_MASK_ERROR_WUP] << 16U)
+	       | ((uint32_t)chipReg[SIM_SPACE_A][ST25R3916_REG_IRQ_MASK_TARGET] << 24U) );
+}
+// END simChipMask
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipNrtNs
+* Date             : 10/19/2026
+* Description      : No response time set in the NRT registers.
+*
+* Input Parameters : none
+*
+* Return		   : time in ns, 0 if the timer is off
+*
+*****************************************************************************/
+
+// BEGIN simChipNrtNs
+static uint64_t simChipNrtNs( void )
+{
+	uint32_t nrt  = (((uint32_t)chipReg[SIM_SPACE_A][ST25R3916_REG_NO_RESPONSE_TIMER1] << 8U) | chipReg[SIM_SPACE_A][ST25R3916_REG_NO_RESPONSE_TIMER2]);
+	uint32_t step = (((chipReg[SIM_SPACE_A][ST25R3916_REG_TIMER_EMV_CONTROL] & ST25R3916_REG_TIMER_EMV_CONTROL_nrt_step) != 0U) ? 4096U : 64U);
+
+	return SIM_CHIP_FC_NS((uint64_t)nrt * step);
+}
+// END simChipNrtNs
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipFifoPush / simChipFifoPop
+* Date             : 10/19/2026
+* Description      : FIFO access. A push into a full FIFO is lost, a pop of
+* 						an empty one reads 0.
+*
+*****************************************************************************/
+
+// BEGIN simChipFifoPush
+static void simChipFifoPush( uint8_t byte )
+{
+	if (fifoCount < ST25R3916_FIFO_DEPTH)
+	{
+		fifo[(fifoHead + fifoCount) % ST25R3916_FIFO_DEPTH] = byte;
+		fifoCount++;
+	}
+}
+// END simChipFifoPush
+
+// BEGIN simChipFifoPop
+static uint8_t simChipFifoPop( void )
+{
+	uint8_t byte = 0;
+
+	if (fifoCount != 0U)
+	{
+		byte     = fifo[fifoHead];
+		fifoHead = (uint16_t)((fifoHead + 1U) % ST25R3916_FIFO_DEPTH);
+		fifoCount--;
+		if (fifoCount < SIM_CHIP_FIFO_WL_RX)
+		{
+			rxFwl = false;
+		}
+	}
+
+	return byte;
+}
+// END simChipFifoPop
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipTxStart
+* Date             : 10/19/2026
+* Description      : Starts sending NUM_TX_BYTES bits from the FIFO: in the
+* 						NFC-V stream mode one FIFO byte lasts 8 pulses of
+* 						the stx period, the framed technologies send a byte
+* 						in 10 etu at 106 kbit/s.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipTxStart
+static void simChipTxStart( void )
+{
+	uint16_t bits = (uint16_t)(((uint16_t)chipReg[SIM_SPACE_A][ST25R3916_REG_NUM_TX_BYTES1] << 8U) | chipReg[SIM_SPACE_A][ST25R3916_REG_NUM_TX_BYTES2]);
+	uint8_t  stx  = (uint8_t)(chipReg[SIM_SPACE_A][ST25R3916_REG_STREAM_MODE] & ST25R3916_REG_STREAM_MODE_stx_mask);
+
+	txStream = ((chipReg[SIM_SPACE_A][ST25R3916_REG_MODE] & ST25R3916_REG_MODE_om_mask) == ST25R3916_REG_MODE_om_subcarrier_stream);
+	txByteNs = (uint32_t)(txStream ? SIM_CHIP_FC_NS(8U << (7U - MIN(stx, 7U))) : SIM_CHIP_FC_NS(128U * SIM_CHIP_ETU_BYTES));
+
+	txExpected = (uint16_t)((bits + 7U) / 8U);
+	txLoaded   = 0;
+	txFwl      = false;
+	txStart    = chipNow;
+	txActive   = true;
+
+	while ((fifoCount != 0U) && (txLoaded < SIM_CHIP_TX_LOG))
+	{
+		txLog[txLoaded++] = simChipFifoPop();
+	}
+
+	simChipTxSchedule();
+}
+// END simChipTxStart
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipTxEvent
+* Date             : 10/19/2026
+* Description      : Transmission event: water level once the bytes left in
+* 						the FIFO drop to SIM_CHIP_FIFO_WL_TX while some are
+* 						still to be loaded, TXE once the last byte is out.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipTxEvent
+static void simChipTxEvent( void )
+{
+	if (!txActive)
+	{
+		return;
+	}
+
+	if (chipNow >= (txStart + ((uint64_t)txExpected * txByteNs)))
+	{
+		simChipTxEnd();
+		return;
+	}
+
+	if (!txFwl && (txLoaded < txExpected))
+	{
+		chipIrq |= ST25R3916_IRQ_MASK_FWL;
+		txFwl    = true;
+	}
+
+	simChipTxSchedule();
+}
+// END simChipTxEvent
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipTxSchedule
+* Date             : 10/19/2026
+* Description      : Times the next transmission event from the bytes
+* 						loaded so far.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipTxSchedule
+static void simChipTxSchedule( void )
+{
+	uint64_t next;
+
+	if (!txActive)
+	{
+		return;
+	}
+
+	next = (txStart + ((uint64_t)txExpected * txByteNs));
+	if (!txFwl && (txLoaded < txExpected))
+	{
+		next = MIN(next, (txStart + ((uint64_t)((txLoaded > SIM_CHIP_FIFO_WL_TX) ? (txLoaded - SIM_CHIP_FIFO_WL_TX) : 0U) * txByteNs)));
+	}
+
+	chipDue[SIM_EV_TX] = MAX(next, chipNow);
+}
+// END simChipTxSchedule
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipTxEnd
+* Date             : 10/19/2026
+* Description      : End of transmission. The NRT starts; an NFC-V request
+* 						is decoded and handed to the tags, and the responses
+* 						in the receive bit rate are coded into the stream
+* 						received after their response delay. Frames of the
+* 						other technologies find nobody.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipTxEnd
+static void simChipTxEnd( void )
+{
+	uint64_t nrt;
+	uint16_t frameLen;
+	uint8_t  answers;
+	uint8_t  scp;
+	uint8_t  i;
+	uint32_t delayNs  = UINT32_MAX;
+	uint16_t replyLen = 0;
+
+	txActive  = false;
+	chipIrq  |= ST25R3916_IRQ_MASK_TXE;
+	chipStats.frames++;
+	chipStats.airNs += (chipNow - txStart);
+
+	nrt = simChipNrtNs();
+	chipDue[SIM_EV_NRT] = ((nrt != 0U) ? (chipNow + nrt) : SIM_CHIP_NO_EVENT);
+
+	if (!txStream)
+	{
+		chipStats.txBytes += txExpected;
+		return;
+	}
+	if (!simChipDecodeVcd(&frameLen) || ((chipReg[SIM_SPACE_A][ST25R3916_REG_OP_CONTROL] & ST25R3916_REG_OP_CONTROL_tx_en) == 0U))
+	{
+		return;
+	}
+	chipStats.txBytes += frameLen;
+
+	scp     = (uint8_t)((chipReg[SIM_SPACE_A][ST25R3916_REG_STREAM_MODE] & ST25R3916_REG_STREAM_MODE_scp_mask) >> ST25R3916_REG_STREAM_MODE_scp_shift);
+	rxBitNs = (uint32_t)SIM_CHIP_FC_NS(32U << scp);
+	answers = simTagsRequest(txFrame, frameLen, rxReplies);
+
+	// Responses ORed into one stream, as the receiver sees several tags
+	ST_MEMSET(rxStream, 0, sizeof(rxStream));
+	for (i = 0; i < answers; i++)
+	{
+		// The reader only decodes the data rate it expects
+		if (rxReplies[i].fast != (scp == 2U))
+		{
+			continue;
+		}
+		simChipRxEncode(&rxReplies[i]);
+		delayNs  = MIN(delayNs, rxReplies[i].delayNs);
+		replyLen = MAX(replyLen, rxReplies[i].len);
+	}
+	if (replyLen == 0U)
+	{
+		return;
+	}
+
+	rxLen     = (uint16_t)(((((uint32_t)replyLen * 16U) + SIM_CHIP_SOF_BITS + SIM_CHIP_EOF_BITS) + 7U) / 8U);
+	rxPushed  = 0;
+	rxFwl     = false;
+	rxStarted = false;
+	rxActive  = true;
+	rxStart   = (chipNow + delayNs);
+	rxEnd     = (rxStart + ((((uint64_t)replyLen * 16U) + SIM_CHIP_SOF_BITS + SIM_CHIP_EOF_BITS) * rxBitNs));
+	chipDue[SIM_EV_RX] = rxStart;
+
+	chipStats.answered++;
+	chipStats.rxBytes += replyLen;
+	chipStats.airNs   += (rxEnd - rxStart);
+}
+// END simChipTxEnd
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipDecodeVcd
+* Date             : 10/19/2026
+* Description      : Decodes the 1 out of 4 or 1 out of 256 pulses loaded
+* 						into the FIFO back into the request bytes. An EOF
+* 						alone is the next slot of an inventory.
+*
+* Input Parameters : frameLen, bytes decoded into txFrame, 0 for an EOF
+* 						alone
+*
+* Return		   : false if the FIFO did not hold a valid frame
+*
+*****************************************************************************/
+
+// BEGIN simChipDecodeVcd
+static bool simChipDecodeVcd( uint16_t *frameLen )
+{
+	uint16_t len = MIN(txLoaded, SIM_CHIP_TX_LOG);
+	uint16_t pos = 1;
+	uint16_t n   = 0;
+	uint8_t  value;
+	uint8_t  pair;
+	uint8_t  k;
+
+	*frameLen = 0;
+	if ((len == 1U) && (txLog[0] == SIM_CHIP_VCD_EOF))
+	{
+		return true;
+	}
+	if ((len < 2U) || (txLog[len - 1U] != SIM_CHIP_VCD_EOF))
+	{
+		return false;
+	}
+
+	if (txLog[0] == SIM_CHIP_VCD_SOF4)
+	{
+		// 4 coded bytes per byte, each one pulse for two bits, lower bits first
+		for (; (pos + 4U) < len; pos += 4U)
+		{
+			value = 0;
+			for (k = 0; k < 4U; k++)
+			{
+				for (pair = 0; (pair < 4U) && (txLog[pos + k] != (uint8_t)(0x02U << (2U * pair))); pair++)
+				{
+				}
+				if (pair == 4U)
+				{
+					return false;
+				}
+				value |= (uint8_t)(pair << (2U * k));
+			}
+			txFrame[n++] = value;
+		}
+	}
+	else if (txLog[0] == SIM_CHIP_VCD_SOF256)
+	{
+		// 64 coded bytes per byte, the one pulse in them is the value
+		for (; (pos + 64U) < len; pos += 64U)
+		{
+			bool found = false;
+
+			value = 0;
+			for (k = 0; k < 64U; k++)
+			{
+				for (pair = 0; (pair < 4U) && (txLog[pos + k] != 0U); pair++)
+				{
+					if (txLog[pos + k] == (uint8_t)(0x02U << (2U * pair)))
+					{
+						value = (uint8_t)((k * 4U) + pair);
+						found = true;
+					}
+				}
+			}
+			if (!found)
+			{
+				return false;
+			}
+			txFrame[n++] = value;
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	*frameLen = n;
+
+	return (pos == (len - 1U));
+}
+// END simChipDecodeVcd
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipRxEncode
+* Date             : 10/19/2026
+* Description      : ORs a response into the subcarrier stream: SOF, each
+* 						bit LSB first as 10 for a 1 and 01 for a 0, EOF. Two
+* 						tags sending different bits give 11, a collision.
+*
+* Input Parameters : reply, response of one tag
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipRxEncode
+static void simChipRxEncode( const SimTagReply *reply )
+{
+	uint32_t bitPos = 0;
+	uint32_t bits;
+	uint32_t count;
+	uint32_t i;
+	uint16_t byte;
+	uint8_t  b;
+
+	for (byte = 0; byte <= (uint16_t)(reply->len + 1U); byte++)
+	{
+		if (byte == 0U)
+		{
+			bits  = 0x17U;
+			count = SIM_CHIP_SOF_BITS;
+		}
+		else if (byte > reply->len)
+		{
+			bits  = 0x1DU;
+			count = SIM_CHIP_EOF_BITS;
+		}
+		else
+		{
+			bits = 0;
+			for (b = 0; b < 8U; b++)
+			{
+				bits |= ((((reply->data[byte - 1U] >> b) & 0x01U) != 0U) ? 0x02UL : 0x01UL) << (2U * b);
+			}
+			count = 16U;
+		}
+
+		for (i = 0; i < count; i++, bitPos++)
+		{
+			if (((bits >> i) & 0x01U) != 0U)
+			{
+				rxStream[bitPos / 8U] |= (uint8_t)(1U << (bitPos % 8U));
+			}
+		}
+	}
+}
+// END simChipRxEncode
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipRxEvent
+* Date             : 10/19/2026
+* Description      : Reception event: RXS once the response starts, then the stream
+* 						bytes go into the FIFO as they arrive, with a water
+* 						level interrupt at SIM_CHIP_FIFO_WL_RX bytes and RXE
+* 						after the EOF. A GPT triggered by the end of
+* 						reception starts there.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipRxEvent
+static void simChipRxEvent( void )
+{
+	uint64_t arrived;
+	uint16_t gpt;
+
+	if (!rxActive)
+	{
+		return;
+	}
+
+	if (!rxStarted)
+	{
+		// The NRT only times out a response that did not start, it stops on the first subcarrier pulse
+		rxStarted = true;
+		chipIrq  |= ST25R3916_IRQ_MASK_RXS;
+		chipDue[SIM_EV_NRT] = SIM_CHIP_NO_EVENT;
+	}
+
+	arrived = ((chipNow - rxStart) / (8U * (uint64_t)rxBitNs));
+	if (chipNow >= rxEnd)
+	{
+		arrived = rxLen;
+	}
+	for (; rxPushed < MIN(arrived, (uint64_t)rxLen); rxPushed++)
+	{
+		simChipFifoPush(rxStream[rxPushed]);
+	}
+
+	if (chipNow >= rxEnd)
+	{
+		rxActive  = false;
+		rxStarted = false;
+		chipIrq  |= ST25R3916_IRQ_MASK_RXE;
+
+		if ((chipReg[SIM_SPACE_A][ST25R3916_REG_TIMER_EMV_CONTROL] & ST25R3916_REG_TIMER_EMV_CONTROL_gptc_mask) == ST25R3916_REG_TIMER_EMV_CONTROL_gptc_erx)
+		{
+			gpt = (uint16_t)(((uint16_t)chipReg[SIM_SPACE_A][ST25R3916_REG_GPT1] << 8U) | chipReg[SIM_SPACE_A][ST25R3916_REG_GPT2]);
+			chipDue[SIM_EV_GPT] = (chipNow + SIM_CHIP_FC_NS(8U * (uint32_t)gpt));
+		}
+		return;
+	}
+
+	if (!rxFwl && (fifoCount >= SIM_CHIP_FIFO_WL_RX))
+	{
+		chipIrq |= ST25R3916_IRQ_MASK_FWL;
+		rxFwl    = true;
+	}
+
+	simChipRxSchedule();
+}
+// END simChipRxEvent
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipRxSchedule
+* Date             : 10/19/2026
+* Description      : Times the next reception event: the end of the
+* 						response, or the FIFO reaching the water level
+* 						before it.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipRxSchedule
+static void simChipRxSchedule( void )
+{
+	uint64_t next;
+	uint16_t level;
+
+	if (!rxActive || !rxStarted)
+	{
+		return;
+	}
+
+	next = rxEnd;
+	if (!rxFwl)
+	{
+		level = (uint16_t)(rxPushed + ((fifoCount < SIM_CHIP_FIFO_WL_RX) ? (SIM_CHIP_FIFO_WL_RX - fifoCount) : 0U));
+		if (level < rxLen)
+		{
+			next = MIN(next, (rxStart + ((uint64_t)level * 8U * rxBitNs)));
+		}
+	}
+
+	chipDue[SIM_EV_RX] = MAX(next, chipNow);
+}
+// END simChipRxSchedule
+
+
+
+
+
+/****************************************************************************
+* Function Name    : simChipStop
+* Date             : 10/19/2026
+* Description      : STOP: clears the FIFO, ends any transmission or
+* 						reception and the NRT. The GPT keeps running.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN simChipStop
+static void simChipStop( void )
+{
+	fifoHead  = 0;
+	fifoCount = 0;
+	txActive  = false;
+	rxActive  = false;
+	rxStarted = false;
+
+	chipDue[SIM_EV_TX]  = SIM_CHIP_NO_EVENT;
+	chipDue[SIM_EV_RX]  = SIM_CHIP_NO_EVENT;
+	chipDue[SIM_EV_NRT] = SIM_CHIP_NO_EVENT;
+}
+// END simChipStop
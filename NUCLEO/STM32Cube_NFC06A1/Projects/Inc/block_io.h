@@ -0,0 +1,108 @@
+/********************************************************************************
+* File Name :	block_io.h
+* Description: Block I/O declaration file
+*		          Reads and writes ranges of tag memory in as few frames as
+*		          the tag allows. The memory layout of each unit is asked
+*		          once with Get System Information and kept by UID; a range
+*		          is then split into Read Multiple Blocks and Write
+*		          Multiple Blocks frames no longer than the tag, the frame
+*		          buffer and the RFAL frame wait time allow. Memories above
+*		          256 blocks are addressed with the extended commands.
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef BLOCK_IO_H	/* Define to prevent recursive inclusion */
+#define BLOCK_IO_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "st_errno.h"
+#include "utils.h"
+
+#ifndef BLOCK_IO_FAST_READ
+#define BLOCK_IO_FAST_READ       1U      // ST25DV read with the ST fast commands, override with -DBLOCK_IO_FAST_READ=0
+#endif
+
+#define BLOCK_IO_UNITS           5U      // units whose memory layout is kept, one per gang unit
+#define BLOCK_IO_FRAME_LEN       64U     // largest data field of one frame, size of the frame buffer
+#define BLOCK_IO_WRITE_FWT_US    20000U  // frame wait time of the RFAL write commands, RFAL_NFCV_FDT_MAX
+#define BLOCK_IO_WRITE_US        5500U   // worst EEPROM programming time of one ST25DV block
+#define BLOCK_IO_ST25DV_BLOCKS   4U      // blocks the ST25DV takes in one Write Multiple Blocks
+#define BLOCK_IO_WRITE_BLOCKS    MIN(BLOCK_IO_ST25DV_BLOCKS, (BLOCK_IO_WRITE_FWT_US / BLOCK_IO_WRITE_US))   // ST25DV blocks written per frame
+
+
+
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : blockIoOpen
+* Date             : 10/19/2026
+* Description      : Makes the unit the one blockIoRead and blockIoWrite work
+* 						on. Its memory layout is asked with Get System
+* 						Information the first time only.
+*
+* Input Parameters : unitUid, UID of the unit as received in the inventory
+* 					 reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+*
+* Return		   : ERR_NONE, a tag not answering is read and written one
+* 					 block at a time
+*
+*****************************************************************************/
+extern ReturnCode blockIoOpen(const uint8_t *unitUid, uint8_t reqFlag, const uint8_t *uid);
+
+
+
+
+/****************************************************************************
+* Function Name    : blockIoRead
+* Date             : 10/19/2026
+* Description      : Reads whole blocks of the unit last opened.
+*
+* Input Parameters : reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+* 					 firstBlock, first block to read
+* 					 data, returns the block data without response flags
+* 					 len, bytes to read, a multiple of the block size
+*
+* Return		   : ERR_NONE, ERR_PARAM for a range outside the memory,
+* 					 else the error of the first frame failing
+*
+*****************************************************************************/
+extern ReturnCode blockIoRead(uint8_t reqFlag, const uint8_t *uid, uint16_t firstBlock, uint8_t *data, uint16_t len);
+
+
+
+
+/****************************************************************************
+* Function Name    : blockIoWrite
+* Date             : 10/19/2026
+* Description      : Writes whole blocks of the unit last opened.
+*
+* Input Parameters : reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+* 					 firstBlock, first block to write
+* 					 data, block data to write
+* 					 len, bytes to write, a multiple of the block size
+*
+* Return		   : ERR_NONE, ERR_PARAM for a range outside the memory,
+* 					 else the error of the first frame failing
+*
+*****************************************************************************/
+extern ReturnCode blockIoWrite(uint8_t reqFlag, const uint8_t *uid, uint16_t firstBlock, const uint8_t *data, uint16_t len);
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF BLOCK_IO_H
@@ -0,0 +1,145 @@
+/********************************************************************************
+* File Name :	boot.h
+* Description: Fast boot declaration file
+*		          Gets the station back to detecting tags quickly after a
+*		          reset: the LED self-test runs from the main loop instead
+*		          of blocking it, the discovery parameters are checked
+*		          without RF and the ST25R3916 regulator calibration is
+*		          cached in the data EEPROM. The boot phase timing is
+*		          reported with the 'S' command. Building with
+*		          BOOT_FAST = 0 restores the original boot sequence.
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef BOOT_H	/* Define to prevent recursive inclusion */
+#define BOOT_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef BOOT_FAST
+#define BOOT_FAST            1U     // fast boot built in, override with -DBOOT_FAST=0
+#endif
+
+#define BOOT_MARKS           6U     // boot phases timed
+#define BOOT_LED_TOGGLES     6U     // LED self-test toggles, same pattern as the original boot
+#define BOOT_LED_MS          200U   // time between two LED self-test toggles
+
+
+
+
+
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : bootMark
+* Date             : 10/19/2026
+* Description      : Records the time since reset at the end of a boot phase.
+*
+* Input Parameters : phase, name of the phase that just ended
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void bootMark(const char *phase);
+
+
+
+
+/****************************************************************************
+* Function Name    : bootReport
+* Date             : 10/19/2026
+* Description      : Sends the boot phase timing and the source of the RF
+* 						calibration via the UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void bootReport(void);
+
+
+
+
+#if BOOT_FAST
+/****************************************************************************
+* Function Name    : bootLedStart
+* Date             : 10/19/2026
+* Description      : Starts the LED self-test. The toggles are done by
+* 						bootLedTask.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void bootLedStart(void);
+
+
+
+
+/****************************************************************************
+* Function Name    : bootLedTask
+* Date             : 10/19/2026
+* Description      : Toggles the LEDs when the next self-test step is due.
+* 						Called from the main loop, returns at once otherwise.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void bootLedTask(void);
+
+
+
+
+/****************************************************************************
+* Function Name    : bootCalLoad
+* Date             : 10/19/2026
+* Description      : Fetches the cached regulator calibration. Used by the
+* 						RFAL in place of the Adjust Regulators command.
+*
+* Input Parameters : supply, IO_CONF2 sup3V bit of the current supply
+* 					 rege, returns the cached regulator setting
+*
+* Return		   : true if a calibration for this supply is cached
+*
+*****************************************************************************/
+extern bool bootCalLoad(uint8_t supply, uint8_t *rege);
+
+
+
+
+/****************************************************************************
+* Function Name    : bootCalStore
+* Date             : 10/19/2026
+* Description      : Caches the result of the Adjust Regulators command in
+* 						the data EEPROM. Only written when it changed.
+*
+* Input Parameters : supply, IO_CONF2 sup3V bit of the current supply
+* 					 rege, regulator setting found by the command
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void bootCalStore(uint8_t supply, uint8_t rege);
+#endif
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF BOOT_H
@@ -0,0 +1,62 @@
+/********************************************************************************
+* File Name :	codec_bench.h
+* Description: ISO15693 codec benchmark declaration file
+*		          Times the CRC, VCD coding and VICC decoding routines of the
+*		          RFAL on the target and checks them against known good frames.
+*		          The measured costs are then used to compare the programming
+*		          strategies for one unit.
+*		          Only built into Debug configurations (DEBUG_OUTPUT = 1).
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef CODEC_BENCH_H	/* Define to prevent recursive inclusion */
+#define CODEC_BENCH_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "st_errno.h"
+
+#define CODEC_BENCH_MIN_MS   250U   // minimum run time of each benchmark, keeps the 1 ms SysTick resolution below 0.5 %
+#define CODEC_BENCH_UNIT_BUDGET_US  110000UL  // modelled air and CPU time of one unit with the current flow, about 105 ms of air
+
+
+
+
+
+#if DEBUG_OUTPUT
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : codecBenchRun
+* Date             : 10/19/2026
+* Description      : Runs the ISO15693 codec benchmarks and golden frame checks
+* 						and prints the results via the UART interface. The RF
+* 						link must be idle, the RFAL coding configuration is
+* 						restored before returning. Ends with the comparison of
+* 						the programming strategies.
+*
+* Input Parameters : none
+*
+* Return		   : ERR_NONE if all golden frame checks passed and the
+* 					 current flow is within CODEC_BENCH_UNIT_BUDGET_US,
+* 					 ERR_INTERNAL otherwise
+*
+*****************************************************************************/
+extern ReturnCode codecBenchRun(void);
+#endif
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF CODEC_BENCH_H
@@ -30,8 +30,10 @@
 
 #define DEMO_NFCV_BLOCK_LEN           4     /*!< NFCV Block len                      */
 
-#define DEMO_NFCV_USE_SELECT_MODE     false /*!< NFCV demonstrate select mode        */
+#define DEMO_NFCV_USE_SELECT_MODE     true  /*!< Program units in select mode, addressed mode if Select fails */
 #define DEMO_NFCV_WRITE_TAG           true //false /*!< NFCV demonstrate Write Single Block */
+#define DEMO_GANG_UNITS               1U    /*!< Units programmed per cycle, up to 5. 1 keeps the single unit flow, more reports one result line per UID */
+#define DEMO_QUIET_UNITS              8U    /*!< Programmed units skipped until the fixture is found empty */
 
 #define BLOCK_SIZE (4)              // canned CC byte count
 #define PWD_SIZE (8)                // canned PWD byte count
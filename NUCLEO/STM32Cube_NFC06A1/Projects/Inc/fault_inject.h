@@ -0,0 +1,121 @@
+/********************************************************************************
+* File Name :	fault_inject.h
+* Description: RF fault injection declaration file
+*		          Turns the result of blocking RF transceives into CRC errors,
+*		          timeouts, collisions, tag removals or password NACKs at a
+*		          configured rate, so the retry policy of the programming flow
+*		          can be measured against known failure profiles. Only built
+*		          into Debug configurations (DEBUG_OUTPUT = 1).
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef FAULT_INJECT_H	/* Define to prevent recursive inclusion */
+#define FAULT_INJECT_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "st_errno.h"
+
+// Order of the rates sent with the 'F' command, each in percent of transceives
+#define FAULT_CRC            0      // response corrupted, ERR_CRC
+#define FAULT_TIMEOUT        1      // no response, ERR_TIMEOUT
+#define FAULT_COLLISION      2      // two tags answered, ERR_RF_COLLISION
+#define FAULT_REMOVAL        3      // tag leaves the field, every transceive times out for FAULT_REMOVAL_MS
+#define FAULT_PWD_NACK       4      // Present Password rejected, ERR_PROTO
+#define FAULT_CONFIG_LEN     5      // number of rates sent with the 'F' command
+
+#define FAULT_REMOVAL_MS     2000U  // time a removed tag stays out of the field
+
+
+
+
+
+#if DEBUG_OUTPUT
+/* ------------------------- Exported Variables ------------------------- */
+extern uint8_t faultConfig[FAULT_CONFIG_LEN];	// Fault rates received with the 'F' command
+
+
+
+
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : faultInjectConfigure
+* Date             : 10/19/2026
+* Description      : Sets the fault rates, restarts the random sequence from
+* 						its fixed seed so runs are repeatable, and clears the
+* 						fault counters. All rates 0 disables injection.
+*
+* Input Parameters : rates, FAULT_CONFIG_LEN rates in percent
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void faultInjectConfigure(const uint8_t *rates);
+
+
+
+
+/****************************************************************************
+* Function Name    : faultInjectTxRxStart
+* Date             : 10/19/2026
+* Description      : Marks the start of a blocking transceive.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void faultInjectTxRxStart(void);
+
+
+
+
+/****************************************************************************
+* Function Name    : faultInjectTxRxEnd
+* Date             : 10/19/2026
+* Description      : Called with the result of a blocking transceive. May
+* 						replace it with an injected fault and accounts the air
+* 						time of transceives that did not succeed.
+*
+* Input Parameters : ret, result of the transceive
+* 					 txBuf, transmitted frame (flags, command, ...)
+* 					 txLen, length of txBuf
+*
+* Return		   : ret or the injected fault
+*
+*****************************************************************************/
+extern ReturnCode faultInjectTxRxEnd(ReturnCode ret, const uint8_t *txBuf, uint16_t txLen);
+
+
+
+
+/****************************************************************************
+* Function Name    : faultInjectReport
+* Date             : 10/19/2026
+* Description      : Sends the fault counters and the wasted air time via the
+* 						UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void faultInjectReport(void);
+#endif
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF FAULT_INJECT_H
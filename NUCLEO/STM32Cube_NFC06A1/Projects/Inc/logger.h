@@ -52,17 +52,27 @@ extern "C" {					// DEFINE C++ Stuff
 
 /* ------------------------- Includes ------------------------- */
 #include "platform.h"
+#include "fault_inject.h"
 
 typedef enum                // Current Command Code, used for Chip Initialization during Test Mode
 {
 	  NONE = 0x00 // No Command Code to process
 	, QUERY_CONFIG = '?' // Send version over UART
 	, PROGRAM = 'P' // Program bytes in program buffer.
+	, STATS = 'S' // Send the station statistics. Does not need a tag.
+	, DUMP_TRACE = 'D' // Send the production trace. Does not need a tag.
+	, BENCHMARK = 'T' // Run the codec benchmark, Debug builds only. Does not need a tag.
+	, FAULT_CONFIG = 'F' // Configure RF fault injection with the bytes in faultConfig, Debug builds only. Does not need a tag.
+	, RF_COUNTERS = 'R' // Send the RF transaction counters, builds with RF_PROBE only. Does not need a tag.
+	, RAM_REPORT = 'M' // Send the stack, heap and static RAM use, builds with RAM_PROBE only. Does not need a tag.
+	, PROGRAM_UID = 'U' // Program bytes in program buffer into the unit matching targetUID. Looks for the unit itself.
 } CommandType;
 
 extern CommandType command;
 #define PROGRAM_LEN 16
 extern uint8_t program[PROGRAM_LEN];
+#define TARGET_LEN 9        // mask length in bits, then the 8 UID bytes most significant first
+extern uint8_t targetUID[TARGET_LEN];
 
 // Send bytes over UART.
 uint8_t logUsartTx(uint8_t *data, uint16_t dataLen);
@@ -144,6 +154,22 @@ extern void init_UART_RX(void);
 
 
 
+/****************************************************************************
+* Function Name    : loggerRxByte
+* Date             : 10/19/2026
+* Description      : Parses one byte of the UART command protocol
+*
+* Input Parameters : read, received byte
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void loggerRxByte(uint8_t read);
+
+
+
+
+
 /****************************************************************************
 * Function Name    : HAL_UART_RxCpltCallback
 * Date             : unknown
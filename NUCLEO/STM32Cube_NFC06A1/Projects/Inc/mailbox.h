@@ -0,0 +1,69 @@
+/********************************************************************************
+* File Name :	mailbox.h
+* Description: Mailbox programming declaration file
+*		          Hands the recipe to the ICM through the ST25DV fast
+*		          transfer mode mailbox instead of writing it into the
+*		          EEPROM, for ICM firmware that reads its recipe from the
+*		          mailbox. The message costs no EEPROM programming time.
+*		          The ST25DV of the unit must have its mailbox allowed
+*		          (MB_MODE). Once the ICM took the message, the recipe
+*		          blocks it stored are read back; a unit that refuses the
+*		          message or whose blocks differ is programmed through
+*		          the EEPROM as before. Building with
+*		          MAILBOX_PROGRAM = 1 adds the path.
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef MAILBOX_H	/* Define to prevent recursive inclusion */
+#define MAILBOX_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "st_errno.h"
+
+#ifndef MAILBOX_PROGRAM
+#define MAILBOX_PROGRAM      0U     // recipe sent through the mailbox, override with -DMAILBOX_PROGRAM=1
+#endif
+
+#define MAILBOX_MSG_MAX      32U    // longest message sent, the ST25DV mailbox holds 256 bytes
+#define MAILBOX_DONE_MS      50U    // time the ICM has to read the message
+
+
+
+#if MAILBOX_PROGRAM
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : mailboxProgram
+* Date             : 10/19/2026
+* Description      : Puts the message into the mailbox of the unit and waits
+* 						for the ICM to read it.
+*
+* Input Parameters : reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+* 					 msg, message to send
+* 					 len, bytes of the message, 1 to MAILBOX_MSG_MAX
+*
+* Return		   : ERR_NONE once the ICM read the message, ERR_TIMEOUT if
+* 					 it did not in time, else the error of the RFAL
+* 					 command failing
+*
+*****************************************************************************/
+extern ReturnCode mailboxProgram(uint8_t reqFlag, const uint8_t *uid, const uint8_t *msg, uint16_t len);
+#endif
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF MAILBOX_H
@@ -176,6 +176,8 @@ extern I2C_HandleTypeDef Handle_I2c1;
 #endif /* MISRAC2012 4.4 : Avoid a section of code seems to be commented out */
 
 int32_t BSP_GetTick(void);
+int32_t BSP_TimeBaseUs_Init(void);
+uint16_t BSP_GetTickUs(void);
 #ifndef RFAL_USE_I2C
 /* BUS IO driver over SPI Peripheral */
 HAL_StatusTypeDef MX_SPI1_Init(SPI_HandleTypeDef * const p_SpiHandle, const uint32_t Baudrate_Presc);
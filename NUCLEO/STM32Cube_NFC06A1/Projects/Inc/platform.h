@@ -45,6 +45,11 @@ extern "C" {
 #include "timer.h"
 #include "main.h"
 #include "logger.h"
+#include "fault_inject.h"
+#include "trace.h"
+#include "rf_probe.h"
+#include "boot.h"
+#include "ram_probe.h"
 
 /* Exported constants --------------------------------------------------------*/
 #define ST25R_SS_PIN             BUS_SPI1_NSS_GPIO_PIN    /*!< GPIO pin used for ST25R SPI SS                */ 
@@ -120,8 +125,31 @@ extern "C" {
 #define platformTimerIsExpired( timer )             timerIsExpired(timer)                          /*!< Checks if the given timer is expired        */
 #define platformTimerDestroy( timer )                                                              /*!< Stop and release the given timer            */
 #define platformDelay( t )                          HAL_Delay( t )                                 /*!< Performs a delay for the given time (ms)    */
+#define platformTimerCreateUs( t )                  timerCalculateTimerUs(t)                       /*!< Create a timer with the given time (us), max 32767 us */
+#define platformTimerIsExpiredUs( timer )           timerIsExpiredUs(timer)                        /*!< Checks if the given us timer is expired     */
+#define platformDelayUs( t )                        timerDelayUs( t )                              /*!< Performs a delay for the given time (us), max 32767 us */
 
 #define platformGetSysTick()                        BSP_GetTick()                                  /*!< Get System Tick ( 1 tick = 1 ms)            */
+#define platformGetSysTickUs()                      BSP_GetTickUs()                                /*!< Get the 16 bit us time base ( 1 tick = 1 us) */
+
+#define platformWaitForInterrupt( cond )            do{ uint32_t pm = __get_PRIMASK();             \
+                                                          __disable_irq();                         \
+                                                          if( cond ) { __WFI(); }                  \
+                                                          __set_PRIMASK(pm);                       \
+                                                        }while(0)                                  /*!< Sleep until the next interrupt if cond still holds with IRQs masked, so an IRQ right before WFI is not lost. SysTick wakes the core at least every 1 ms */
+#define platformGetCycleStamp()                     (SysTick->LOAD - SysTick->VAL)                 /*!< Core cycles elapsed in the current SysTick period, used to measure latencies below 1 ms */
+#define platformCycleStampPeriod()                  (SysTick->LOAD + 1U)                           /*!< Core cycles in one SysTick period           */
+
+#define platformRfTxRxStart()                       traceRfStart()                                 /*!< Called before each blocking RF transceive   */
+#define platformRfTxRxEnd( ret, txBuf, txLen, rxLen ) traceRfEnd( (ret), (txBuf), (txLen), (rxLen) ) /*!< Called with the result of each blocking RF transceive, returns the result to use (fault injection on Debug builds) */
+#if RF_PROBE
+#define ST25R_COM_PROFILE                                                                          /*!< Count the ST25R3916 SPI traffic per phase, reported with the RF probe */
+#endif
+
+#if BOOT_FAST
+#define platformRfCalibrationLoad( supply, rege )   bootCalLoad( (supply), (rege) )                /*!< Fetch the cached regulator setting for the supply, true if cached */
+#define platformRfCalibrationStore( supply, rege )  bootCalStore( (supply), (rege) )               /*!< Cache the regulator setting found by Adjust Regulators           */
+#endif
 
 #define platformErrorHandle()                       _Error_Handler(__FILE__,__LINE__)              /*!< Global error handler or trap                */
 
@@ -190,6 +218,7 @@ extern uint8_t globalCommProtectCnt;                      /* Global Protection C
   that are optimized differently for each board.
 */
 #define RFAL_ANALOG_CONFIG_CUSTOM                         /*!< Use Custom Analog Configs when defined                                    */
+#define RFAL_NFCV_ADAPTIVE_FWT                 true       /*!< Learn the NFC-V FWT of each command from the responses of the tag in the field */
 
 /* Exported variables --------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
@@ -0,0 +1,108 @@
+/********************************************************************************
+* File Name :	ram_probe.h
+* Description: RAM budget probe declaration file
+*		          Paints the free stack and keeps the stack high-water mark
+*		          of each call path of the main loop. Read back with the 'M'
+*		          UART command together with the heap use and the static
+*		          RAM of each module group. The static budget itself is
+*		          checked at link time by the linker script. Building with
+*		          RAM_PROBE = 0 removes the probe and the command.
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef RAM_PROBE_H	/* Define to prevent recursive inclusion */
+#define RAM_PROBE_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+
+#ifndef RAM_PROBE
+#define RAM_PROBE            1U     // RAM budget probe built in, override with -DRAM_PROBE=0
+#endif
+
+#define RAM_PATH_DISCOVERY   0U     // RFAL worker, includes the RF interrupts
+#define RAM_PATH_COMMAND     1U     // handling of a UART command that needs no tag, includes its report
+#define RAM_PATH_PROGRAM     2U     // programming of a unit
+#define RAM_PATHS            3U     // call paths measured
+
+
+
+#if RAM_PROBE
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : ramProbeInit
+* Date             : 10/19/2026
+* Description      : Paints the whole free stack. Called first thing in main.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void ramProbeInit(void);
+
+
+
+
+/****************************************************************************
+* Function Name    : ramProbePathStart
+* Date             : 10/19/2026
+* Description      : Paints the stack below the caller, right before a
+* 						call path is entered.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void ramProbePathStart(void);
+
+
+
+
+/****************************************************************************
+* Function Name    : ramProbePathEnd
+* Date             : 10/19/2026
+* Description      : Finds the deepest stack use since ramProbePathStart and
+* 						keeps it as high-water mark of the call path.
+*
+* Input Parameters : path, RAM_PATH_xxx call path that just returned
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void ramProbePathEnd(uint8_t path);
+
+
+
+
+/****************************************************************************
+* Function Name    : ramProbeReport
+* Date             : 10/19/2026
+* Description      : Sends the stack, heap and static RAM use via the UART
+* 						interface. The high-water marks are kept.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void ramProbeReport(void);
+#endif
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF RAM_PROBE_H
@@ -0,0 +1,80 @@
+/********************************************************************************
+* File Name :	rf_probe.h
+* Description: RF transaction probe declaration file
+*		          Counts the blocking RF transceives of the RFAL per NFC-V
+*		          command code: calls, bytes, latency and failures by error
+*		          code. Read back with the 'R' UART command, together with
+*		          the ST25R3916 SPI traffic per phase. Building with
+*		          RF_PROBE = 0 removes the probe, the SPI profile and the
+*		          command.
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef RF_PROBE_H	/* Define to prevent recursive inclusion */
+#define RF_PROBE_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "st_errno.h"
+
+#ifndef RF_PROBE
+#define RF_PROBE             1U     // RF transaction probe built in, override with -DRF_PROBE=0
+#endif
+
+#define RF_PROBE_CMDS        10U    // distinct command codes counted, 32 bytes each
+
+
+
+#if RF_PROBE
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : rfProbeRecord
+* Date             : 10/19/2026
+* Description      : Counts one blocking RF transceive. Called by the trace
+* 						module with the final result of the transceive.
+*
+* Input Parameters : cmd, NFC-V command code
+* 					 txLen, bytes sent
+* 					 rxLen, bytes received
+* 					 ret, result of the transceive
+* 					 durUs, duration in us
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void rfProbeRecord(uint8_t cmd, uint16_t txLen, uint16_t rxLen, ReturnCode ret, uint16_t durUs);
+
+
+
+
+/****************************************************************************
+* Function Name    : rfProbeReport
+* Date             : 10/19/2026
+* Description      : Sends the counters via the UART interface, one comma
+* 						separated line per command code, followed by the
+* 						interrupt wake-up latency. The counters are kept.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void rfProbeReport(void);
+#endif
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF RF_PROBE_H
@@ -0,0 +1,129 @@
+/********************************************************************************
+* File Name :	stats.h
+* Description: Station statistics declaration file
+*		          Keeps per-unit programming times and derives the station
+*		          throughput in units per hour. The report is sent over the
+*		          UART on request with the 'S' command.
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef STATS_H	/* Define to prevent recursive inclusion */
+#define STATS_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+
+#define STATS_MS_PER_HOUR   3600000UL   // milliseconds in one hour
+
+
+
+
+
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : statsUnitArmed
+* Date             : 10/19/2026
+* Description      : Marks the start of a unit cycle, called when a program
+* 						command has been received over the UART.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void statsUnitArmed(void);
+
+
+
+
+/****************************************************************************
+* Function Name    : statsUnitWriteStart
+* Date             : 10/19/2026
+* Description      : Marks the start of the RF programming of a unit.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void statsUnitWriteStart(void);
+
+
+
+
+/****************************************************************************
+* Function Name    : statsUnitWriteDone
+* Date             : 10/19/2026
+* Description      : Marks the end of the RF programming of a unit.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void statsUnitWriteDone(void);
+
+
+
+
+/****************************************************************************
+* Function Name    : statsUnitDone
+* Date             : 10/19/2026
+* Description      : Marks the end of a unit cycle, right before the result
+* 						is reported to the UI.
+*
+* Input Parameters : pass, true if the unit was programmed successfully
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void statsUnitDone(bool pass);
+
+
+
+
+/****************************************************************************
+* Function Name    : statsReport
+* Date             : 10/19/2026
+* Description      : Sends the station statistics via the UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void statsReport(void);
+
+
+
+
+
+/****************************************************************************
+* Function Name    : statsReset
+* Date             : 10/19/2026
+* Description      : Clears all station statistics, e.g. at the start of a
+* 						fault injection scenario.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void statsReset(void);
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF STATS_H
@@ -0,0 +1,113 @@
+/********************************************************************************
+* File Name :	trace.h
+* Description: Production trace declaration file
+*		          Records every blocking RF transceive and every UART command
+*		          and result into a RAM ring, so the latest activity of a
+*		          station can be read back with the 'D' command after a
+*		          slowdown has been noticed.
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef TRACE_H	/* Define to prevent recursive inclusion */
+#define TRACE_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+#include "st_errno.h"
+
+#define TRACE_DEPTH          32U    // entries kept in the ring, 12 bytes each
+
+#define TRACE_RF             'R'    // blocking RF transceive
+#define TRACE_UART_RX        'U'    // UART command received
+#define TRACE_UART_TX        'O'    // result sent to the UI
+
+
+
+
+
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : traceRfStart
+* Date             : 10/19/2026
+* Description      : Marks the start of a blocking RF transceive. Called by
+* 						the RFAL through platformRfTxRxStart.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void traceRfStart(void);
+
+
+
+
+/****************************************************************************
+* Function Name    : traceRfEnd
+* Date             : 10/19/2026
+* Description      : Records a blocking RF transceive. Called by the RFAL
+* 						through platformRfTxRxEnd. On Debug builds the result
+* 						first goes through the fault injection. The final
+* 						result is also counted by the RF probe.
+*
+* Input Parameters : ret, result of the transceive
+* 					 txBuf, transmitted frame (flags, command, ...)
+* 					 txLen, length of txBuf in bytes
+* 					 rxLen, received bytes
+*
+* Return		   : result of the transceive
+*
+*****************************************************************************/
+extern ReturnCode traceRfEnd(ReturnCode ret, const uint8_t *txBuf, uint16_t txLen, uint16_t rxLen);
+
+
+
+
+/****************************************************************************
+* Function Name    : traceUart
+* Date             : 10/19/2026
+* Description      : Records a UART command or a result sent to the UI.
+*
+* Input Parameters : kind, TRACE_UART_RX or TRACE_UART_TX
+* 					 cmd, command code or result code
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void traceUart(uint8_t kind, uint8_t cmd);
+
+
+
+
+/****************************************************************************
+* Function Name    : traceDump
+* Date             : 10/19/2026
+* Description      : Sends the trace via the UART interface, oldest entry
+* 						first, one comma separated line per entry:
+* 						tick ms, kind, command, command name, tx bytes,
+* 						rx bytes, result, duration us. A summary per NFC-V
+* 						command follows. The trace is kept.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void traceDump(void);
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF TRACE_H
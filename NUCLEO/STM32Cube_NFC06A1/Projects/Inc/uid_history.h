@@ -0,0 +1,119 @@
+/********************************************************************************
+* File Name :	uid_history.h
+* Description: Unit history declaration file
+*		          Remembers the recently programmed units by UID, with the
+*		          hash of the recipe they got and the result. A unit that
+*		          already passed with the same recipe is acknowledged
+*		          without being written again, a unit coming back with
+*		          another recipe or after a failure is counted and flagged
+*		          to the host. The counts are reported with the 'S'
+*		          command. Building with
+*		          UID_HISTORY = 0 removes the history.
+*
+*******************************************************************************/
+
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#ifndef UID_HISTORY_H	/* Define to prevent recursive inclusion */
+#define UID_HISTORY_H
+
+#ifdef __cplusplus				// IF we are using C++
+extern "C" {					// DEFINE C++ Stuff
+#endif							// END IF
+
+/* ------------------------- Includes ------------------------- */
+#include "platform.h"
+
+#ifndef UID_HISTORY
+#define UID_HISTORY          1U     // unit history built in, override with -DUID_HISTORY=0
+#endif
+
+#define UID_HISTORY_SLOTS    32U    // units remembered, power of 2, 12 bytes each
+#define UID_HISTORY_PROBES   4U     // slots looked at for one UID, the oldest of them is replaced when all are used
+
+#define UID_HISTORY_NEW      0U     // unit not seen yet
+#define UID_HISTORY_DONE     1U     // unit passed with the same recipe
+#define UID_HISTORY_CHANGED  2U     // unit passed with another recipe
+#define UID_HISTORY_FAILED   3U     // unit failed its last programming
+
+
+
+#if UID_HISTORY
+/* ------------------------- Exported Function Prototypes ------------------------- */
+/****************************************************************************
+* Function Name    : uidHistoryCheck
+* Date             : 10/19/2026
+* Description      : Looks the unit up and counts it as already done,
+* 						changed recipe or failed before.
+*
+* Input Parameters : uid, UID of the unit as received in the inventory
+* 					 recipe, hash of the recipe about to be programmed
+*
+* Return		   : UID_HISTORY_xxx state of the unit
+*
+*****************************************************************************/
+extern uint8_t uidHistoryCheck(const uint8_t *uid, uint16_t recipe);
+
+
+
+
+/****************************************************************************
+* Function Name    : uidHistoryStore
+* Date             : 10/19/2026
+* Description      : Keeps the result of a unit programming.
+*
+* Input Parameters : uid, UID of the unit as received in the inventory
+* 					 recipe, hash of the recipe programmed
+* 					 pass, true if the unit was programmed and verified
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void uidHistoryStore(const uint8_t *uid, uint16_t recipe, bool pass);
+
+
+
+
+/****************************************************************************
+* Function Name    : uidHistoryFlag
+* Date             : 10/19/2026
+* Description      : Tells the host about a unit seen before, one line with
+* 						the UID then DUPLICATE for a unit that already got
+* 						this recipe or failed it, REPLACED for a unit whose
+* 						recipe is being replaced. Nothing is sent for a new
+* 						unit.
+*
+* Input Parameters : uid, UID of the unit as received in the inventory
+* 					 state, UID_HISTORY_xxx state from uidHistoryCheck
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void uidHistoryFlag(const uint8_t *uid, uint8_t state);
+
+
+
+
+/****************************************************************************
+* Function Name    : uidHistoryReport
+* Date             : 10/19/2026
+* Description      : Sends the unit history counts via the UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+extern void uidHistoryReport(void);
+#endif
+
+
+
+#ifdef __cplusplus				// IF we are using C++
+}								// DEFINE C++ Stuff
+#endif							// END IF
+
+#endif 							// END IF UID_HISTORY_H
@@ -0,0 +1,478 @@
+/*********************************************************************************
+* File Name :	block_io.c
+* Description: Block I/O implementation file
+*		          A frame carries at most BLOCK_IO_FRAME_LEN data bytes,
+*		          which also keeps reads well within the RFAL RF buffer.
+*		          Reads are further limited by the memory size only. Write
+*		          Multiple Blocks is only used on the ST25DV, up to the
+*		          blocks it takes in one command and it can program within
+*		          the RFAL frame wait time; any other tag is written one
+*		          block at a time. A tag not reporting its memory size is
+*		          taken as the ST25DV04K the ICM325A is built with.
+*		          Memories above 256 blocks, the ST25DV16K and ST25DV64K,
+*		          are read and written with the extended commands only:
+*		          their 16 bit block numbers let a frame run across block
+*		          256 as any other. The ST25DV is read with the ST fast
+*		          commands, which answer at twice the data rate.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "block_io.h"
+#include "logger.h"
+#include "rfal_nfcv.h"
+#include "rfal_st25xv.h"
+#include <string.h>
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define BLOCK_IO_BUF_LEN         (BLOCK_IO_FRAME_LEN + 16U)  // flags, command, UID, block range and CRC around the data
+#define BLOCK_IO_DEF_BLOCKS      128U    // ST25DV04K memory, 128 blocks
+#define BLOCK_IO_DEF_BLOCK_SIZE  4U      // ST25DV04K block size
+#define BLOCK_IO_STD_BLOCKS      256U    // blocks reachable with 8 bit block numbers
+
+#define BLOCK_IO_MANUF_POS       6U      // IC manufacturer code within the UID
+#define BLOCK_IO_MANUF_ST        0x02U   // STMicroelectronics
+#define BLOCK_IO_SYSINFO_POS     10U     // first optional field of Get System Information, after flags, info flags and UID
+#define BLOCK_IO_EXT_REQUEST     (RFAL_NFCV_SYSINFO_MEMSIZE | RFAL_NFCV_SYSINFO_ICREF)   // fields asked with Extended Get System Information
+
+
+
+
+
+/* ------------------------- Private Types ------------------------- */
+typedef struct
+{
+	uint8_t  uid[RFAL_NFCV_UID_LEN];	// UID as received in the inventory
+	uint16_t blockCount;				// blocks of user memory
+	uint8_t  blockSize;					// bytes of one block
+	uint8_t  icRef;						// IC reference, 0 if not reported
+	uint8_t  readBlocks;				// most blocks read in one frame
+	uint8_t  writeBlocks;				// most blocks written in one frame
+	bool     extended;					// 16 bit block numbers, extended commands
+	bool     fastRead;					// read with the ST fast commands
+	bool     used;						// entry holds a unit
+} BlockIoPlan;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static BlockIoPlan  blockIoPlans[BLOCK_IO_UNITS];	// memory layout of the units last opened
+static BlockIoPlan *blockIoCur;						// unit read and written
+static uint8_t      blockIoNext;					// entry replaced by the next new unit
+static uint8_t      blockIoBuf[BLOCK_IO_BUF_LEN];	// request or response of one frame
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static bool blockIoSystemInfo( BlockIoPlan *plan, uint8_t reqFlag, const uint8_t *uid );
+static bool blockIoRange( uint16_t firstBlock, uint16_t len );
+static ReturnCode blockIoReadFrame( uint8_t reqFlag, const uint8_t *uid, uint16_t block, uint8_t blocks, uint16_t *rcvLen );
+static ReturnCode blockIoWriteFrame( uint8_t reqFlag, const uint8_t *uid, uint16_t block, uint8_t blocks, const uint8_t *data );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : blockIoOpen
+* Date             : 10/19/2026
+* Description      : Makes the unit the one blockIoRead and blockIoWrite work
+* 						on. A unit seen for the first time replaces the
+* 						oldest one kept and its memory layout is asked.
+*
+* Input Parameters : unitUid, UID of the unit as received in the inventory
+* 					 reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+*
+* Return		   : ERR_NONE, a tag not answering is read and written one
+* 					 block at a time and asked again on the next open
+*
+*****************************************************************************/
+
+// BEGIN blockIoOpen
+ReturnCode blockIoOpen(const uint8_t *unitUid, uint8_t reqFlag, const uint8_t *uid)
+{
+	bool    st25dv;
+	uint8_t i;
+
+	for (i = 0; i < BLOCK_IO_UNITS; i++)
+	{
+		if (blockIoPlans[i].used && (memcmp(blockIoPlans[i].uid, unitUid, RFAL_NFCV_UID_LEN) == 0))
+		{
+			blockIoCur = &blockIoPlans[i];
+			return ERR_NONE;
+		}
+	}
+
+	blockIoCur  = &blockIoPlans[blockIoNext];
+	blockIoNext = ((blockIoNext + 1U) % BLOCK_IO_UNITS);
+
+	ST_MEMCPY(blockIoCur->uid, unitUid, RFAL_NFCV_UID_LEN);
+	blockIoCur->blockCount = BLOCK_IO_DEF_BLOCKS;
+	blockIoCur->blockSize  = BLOCK_IO_DEF_BLOCK_SIZE;
+	blockIoCur->icRef      = 0;
+	blockIoCur->used       = blockIoSystemInfo(blockIoCur, reqFlag, uid);
+
+	// ST25DV and ST25DV-C IC references
+	st25dv = ( (unitUid[BLOCK_IO_MANUF_POS] == BLOCK_IO_MANUF_ST)
+	        && (((blockIoCur->icRef & 0xFCU) == 0x24U) || ((blockIoCur->icRef & 0xFEU) == 0x50U)) );
+
+	// Commands and frame sizes from the layout
+	blockIoCur->extended    = (blockIoCur->blockCount > BLOCK_IO_STD_BLOCKS);
+	blockIoCur->fastRead    = ((BLOCK_IO_FAST_READ != 0U) && st25dv);
+	blockIoCur->readBlocks  = (uint8_t)MIN(MIN((BLOCK_IO_FRAME_LEN / blockIoCur->blockSize), blockIoCur->blockCount), BLOCK_IO_STD_BLOCKS - 1U);
+	blockIoCur->writeBlocks = 1U;
+	if (!blockIoCur->used)
+	{
+		// Layout unknown, single blocks only
+		blockIoCur->readBlocks = 1U;
+	}
+	if (st25dv)
+	{
+		blockIoCur->writeBlocks = (uint8_t)MIN(BLOCK_IO_WRITE_BLOCKS, (BLOCK_IO_FRAME_LEN / blockIoCur->blockSize));
+	}
+
+	DEBUG_LOG("Memory: %u blocks of %u, IC ref %02X, frames read %u, write %u, extended %u, fast %u\r\n", blockIoCur->blockCount,
+	          blockIoCur->blockSize, blockIoCur->icRef, blockIoCur->readBlocks, blockIoCur->writeBlocks,
+	          blockIoCur->extended, blockIoCur->fastRead);
+
+	return ERR_NONE;
+}
+// END blockIoOpen
+
+
+
+
+
+/****************************************************************************
+* Function Name    : blockIoRead
+* Date             : 10/19/2026
+* Description      : Reads whole blocks of the unit last opened, as many
+* 						blocks per frame as its layout allows.
+*
+* Input Parameters : reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+* 					 firstBlock, first block to read
+* 					 data, returns the block data without response flags
+* 					 len, bytes to read, a multiple of the block size
+*
+* Return		   : ERR_NONE, ERR_PARAM for a range outside the memory,
+* 					 else the error of the first frame failing
+*
+*****************************************************************************/
+
+// BEGIN blockIoRead
+ReturnCode blockIoRead(uint8_t reqFlag, const uint8_t *uid, uint16_t firstBlock, uint8_t *data, uint16_t len)
+{
+	ReturnCode error;
+	uint16_t   rcvLen;
+	uint16_t   bytes;
+	uint8_t    blocks;
+
+	if (!blockIoRange(firstBlock, len))
+	{
+		return ERR_PARAM;
+	}
+
+	while (len != 0U)
+	{
+		blocks = (uint8_t)MIN((len / blockIoCur->blockSize), blockIoCur->readBlocks);
+		bytes  = ((uint16_t)blocks * blockIoCur->blockSize);
+
+		error = blockIoReadFrame(reqFlag, uid, firstBlock, blocks, &rcvLen);
+		if (error != ERR_NONE)
+		{
+			return error;
+		}
+		if (rcvLen != (1U + bytes))
+		{
+			return ERR_PROTO;
+		}
+
+		// Response flags first
+		ST_MEMCPY(data, &blockIoBuf[1], bytes);
+		data       += bytes;
+		len        -= bytes;
+		firstBlock += blocks;
+	}
+
+	return ERR_NONE;
+}
+// END blockIoRead
+
+
+
+
+
+/****************************************************************************
+* Function Name    : blockIoWrite
+* Date             : 10/19/2026
+* Description      : Writes whole blocks of the unit last opened, as many
+* 						blocks per frame as its layout allows.
+*
+* Input Parameters : reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+* 					 firstBlock, first block to write
+* 					 data, block data to write
+* 					 len, bytes to write, a multiple of the block size
+*
+* Return		   : ERR_NONE, ERR_PARAM for a range outside the memory,
+* 					 else the error of the first frame failing
+*
+*****************************************************************************/
+
+// BEGIN blockIoWrite
+ReturnCode blockIoWrite(uint8_t reqFlag, const uint8_t *uid, uint16_t firstBlock, const uint8_t *data, uint16_t len)
+{
+	ReturnCode error;
+	uint16_t   bytes;
+	uint8_t    blocks;
+
+	if (!blockIoRange(firstBlock, len))
+	{
+		return ERR_PARAM;
+	}
+
+	while (len != 0U)
+	{
+		blocks = (uint8_t)MIN((len / blockIoCur->blockSize), blockIoCur->writeBlocks);
+		bytes  = ((uint16_t)blocks * blockIoCur->blockSize);
+
+		error = blockIoWriteFrame(reqFlag, uid, firstBlock, blocks, data);
+		if (error != ERR_NONE)
+		{
+			return error;
+		}
+
+		data       += bytes;
+		len        -= bytes;
+		firstBlock += blocks;
+	}
+
+	return ERR_NONE;
+}
+// END blockIoWrite
+
+
+
+
+
+/****************************************************************************
+* Function Name    : blockIoSystemInfo
+* Date             : 10/19/2026
+* Description      : Asks the memory size and IC reference with Get System
+* 						Information, then with Extended Get System
+* 						Information if the first does not report the size
+* 						or reports the most it can, 256 blocks. Fields not
+* 						reported keep their default.
+*
+* Input Parameters : plan, layout of the unit, updated
+* 					 reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+*
+* Return		   : true if the unit answered either command
+*
+*****************************************************************************/
+
+// BEGIN blockIoSystemInfo
+static bool blockIoSystemInfo( BlockIoPlan *plan, uint8_t reqFlag, const uint8_t *uid )
+{
+	uint16_t rcvLen;
+	uint8_t  info;
+	uint8_t  pos = BLOCK_IO_SYSINFO_POS;
+	bool     answered = false;
+
+	if (rfalNfcvPollerGetSystemInformation(reqFlag, uid, blockIoBuf, sizeof(blockIoBuf), &rcvLen) == ERR_NONE)
+	{
+		answered = true;
+		info  = blockIoBuf[1];
+		pos  += (((info & RFAL_NFCV_SYSINFO_DFSID) != 0U) ? 1U : 0U);
+		pos  += (((info & RFAL_NFCV_SYSINFO_AFI) != 0U) ? 1U : 0U);
+
+		if (((info & RFAL_NFCV_SYSINFO_MEMSIZE) != 0U) && (rcvLen >= (pos + 2U)))
+		{
+			plan->blockCount = ((uint16_t)blockIoBuf[pos] + 1U);
+			plan->blockSize  = ((blockIoBuf[pos + 1U] & 0x1FU) + 1U);
+			pos += 2U;
+
+			if (((info & RFAL_NFCV_SYSINFO_ICREF) != 0U) && (rcvLen > pos))
+			{
+				plan->icRef = blockIoBuf[pos];
+			}
+			if (plan->blockCount < BLOCK_IO_STD_BLOCKS)
+			{
+				return true;
+			}
+		}
+	}
+
+	// Memories above 256 blocks only report their size in the extended command
+	pos = BLOCK_IO_SYSINFO_POS;
+	if (rfalNfcvPollerExtendedGetSystemInformation(reqFlag, uid, BLOCK_IO_EXT_REQUEST, blockIoBuf, sizeof(blockIoBuf), &rcvLen) == ERR_NONE)
+	{
+		answered = true;
+		info     = blockIoBuf[1];
+
+		if (((info & RFAL_NFCV_SYSINFO_MEMSIZE) != 0U) && (rcvLen >= (pos + 3U)))
+		{
+			plan->blockCount = (((uint16_t)blockIoBuf[pos] | ((uint16_t)blockIoBuf[pos + 1U] << 8U)) + 1U);
+			plan->blockSize  = ((blockIoBuf[pos + 2U] & 0x1FU) + 1U);
+			pos += 3U;
+		}
+		if (((info & RFAL_NFCV_SYSINFO_ICREF) != 0U) && (rcvLen > pos))
+		{
+			plan->icRef = blockIoBuf[pos];
+		}
+	}
+
+	return answered;
+}
+// END blockIoSystemInfo
+
+
+
+
+
+/****************************************************************************
+* Function Name    : blockIoRange
+* Date             : 10/19/2026
+* Description      : Checks a range against the memory of the unit last
+* 						opened. A memory read with the standard commands
+* 						never exceeds their 8 bit block numbers.
+*
+* Input Parameters : firstBlock, first block of the range
+* 					 len, bytes of the range
+*
+* Return		   : true if the range can be read and written
+*
+*****************************************************************************/
+
+// BEGIN blockIoRange
+static bool blockIoRange( uint16_t firstBlock, uint16_t len )
+{
+	uint32_t end;
+
+	if ((blockIoCur == NULL) || (len == 0U) || ((len % blockIoCur->blockSize) != 0U))
+	{
+		return false;
+	}
+
+	end = ((uint32_t)firstBlock + (len / blockIoCur->blockSize));
+
+	return (end <= blockIoCur->blockCount);
+}
+// END blockIoRange
+
+
+
+
+
+/****************************************************************************
+* Function Name    : blockIoReadFrame
+* Date             : 10/19/2026
+* Description      : Reads one frame of blocks into blockIoBuf with the read
+* 						command of the unit last opened: single or
+* 						multiple, standard or extended, normal or fast.
+*
+* Input Parameters : reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+* 					 block, first block to read
+* 					 blocks, blocks to read, at most readBlocks
+* 					 rcvLen, returns the response length with the flags
+*
+* Return		   : error of the RFAL command
+*
+*****************************************************************************/
+
+// BEGIN blockIoReadFrame
+static ReturnCode blockIoReadFrame( uint8_t reqFlag, const uint8_t *uid, uint16_t block, uint8_t blocks, uint16_t *rcvLen )
+{
+	// The block count goes on air as is, ISO15693 counts from 0
+	uint8_t last = (blocks - 1U);
+
+	if (blockIoCur->extended)
+	{
+		if (blockIoCur->fastRead)
+		{
+			if (blocks == 1U)
+			{
+				return rfalST25xVPollerFastExtendedReadSingleBlock(reqFlag, uid, block, blockIoBuf, sizeof(blockIoBuf), rcvLen);
+			}
+			return rfalST25xVPollerFastExtReadMultipleBlocks(reqFlag, uid, block, last, blockIoBuf, sizeof(blockIoBuf), rcvLen);
+		}
+
+		if (blocks == 1U)
+		{
+			return rfalNfcvPollerExtendedReadSingleBlock(reqFlag, uid, block, blockIoBuf, sizeof(blockIoBuf), rcvLen);
+		}
+		return rfalNfcvPollerExtendedReadMultipleBlocks(reqFlag, uid, block, last, blockIoBuf, sizeof(blockIoBuf), rcvLen);
+	}
+
+	if (blockIoCur->fastRead)
+	{
+		if (blocks == 1U)
+		{
+			return rfalST25xVPollerFastReadSingleBlock(reqFlag, uid, (uint8_t)block, blockIoBuf, sizeof(blockIoBuf), rcvLen);
+		}
+		return rfalST25xVPollerFastReadMultipleBlocks(reqFlag, uid, (uint8_t)block, last, blockIoBuf, sizeof(blockIoBuf), rcvLen);
+	}
+
+	if (blocks == 1U)
+	{
+		return rfalNfcvPollerReadSingleBlock(reqFlag, uid, (uint8_t)block, blockIoBuf, sizeof(blockIoBuf), rcvLen);
+	}
+	return rfalNfcvPollerReadMultipleBlocks(reqFlag, uid, (uint8_t)block, last, blockIoBuf, sizeof(blockIoBuf), rcvLen);
+}
+// END blockIoReadFrame
+
+
+
+
+
+/****************************************************************************
+* Function Name    : blockIoWriteFrame
+* Date             : 10/19/2026
+* Description      : Writes one frame of blocks with the write command of the
+* 						unit last opened: single or multiple, standard or
+* 						extended.
+*
+* Input Parameters : reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+* 					 block, first block to write
+* 					 blocks, blocks to write, at most writeBlocks
+* 					 data, block data to write
+*
+* Return		   : error of the RFAL command
+*
+*****************************************************************************/
+
+// BEGIN blockIoWriteFrame
+static ReturnCode blockIoWriteFrame( uint8_t reqFlag, const uint8_t *uid, uint16_t block, uint8_t blocks, const uint8_t *data )
+{
+	uint8_t  size  = blockIoCur->blockSize;
+	uint16_t bytes = ((uint16_t)blocks * size);
+
+	// RFAL takes the block count of the multiple writes as is
+	if (blockIoCur->extended)
+	{
+		if (blocks == 1U)
+		{
+			return rfalNfcvPollerExtendedWriteSingleBlock(reqFlag, uid, block, data, size);
+		}
+		return rfalNfcvPollerExtendedWriteMultipleBlocks(reqFlag, uid, block, blocks, blockIoBuf, sizeof(blockIoBuf), size, data, bytes);
+	}
+
+	if (blocks == 1U)
+	{
+		return rfalNfcvPollerWriteSingleBlock(reqFlag, uid, (uint8_t)block, data, size);
+	}
+	return rfalNfcvPollerWriteMultipleBlocks(reqFlag, uid, (uint8_t)block, blocks, blockIoBuf, sizeof(blockIoBuf), size, data, bytes);
+}
+// END blockIoWriteFrame
@@ -0,0 +1,307 @@
+/*********************************************************************************
+* File Name :	boot.c
+* Description: Fast boot implementation file
+*		          Boot times are taken from the SysTick, so they count from
+*		          HAL_Init. The regulator calibration is kept in the first
+*		          word of the data EEPROM together with the supply it was
+*		          measured at; a change of supply or an erased EEPROM makes
+*		          the RFAL run the Adjust Regulators command again.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "boot.h"
+#include "platform.h"
+#include "logger.h"
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define BOOT_CAL_ADDR        DATA_EEPROM_BASE    // data EEPROM word holding the calibration
+#define BOOT_CAL_MAGIC       0xCAU               // marks a valid calibration word
+#define BOOT_CAL_SUPPLY      0x80U               // supply bit of the setting byte, same as IO_CONF2 sup3V
+#define BOOT_CAL_REGE_MASK   0x0FU               // regulator setting bits of the setting byte
+
+#define BOOT_CAL_NONE        0U                  // RFAL did not ask, regulators set by the analog configuration
+#define BOOT_CAL_MEASURED    1U                  // Adjust Regulators command executed
+#define BOOT_CAL_CACHED      2U                  // setting taken from the data EEPROM
+
+
+
+
+
+/* ------------------------- Private Types ------------------------- */
+typedef struct
+{
+	const char *phase;			// name of the phase
+	uint32_t    us;				// time since reset at the end of the phase
+} BootMark;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static BootMark bootMarks[BOOT_MARKS];		// boot phases in the order they ended
+static uint8_t  bootMarkCount;				// boot phases recorded
+
+#if BOOT_FAST
+static uint8_t  bootCalState;				// BOOT_CAL_xxx source of the regulator setting
+static uint8_t  bootCalRege;				// regulator setting in use
+static uint8_t  bootLedLeft;				// LED self-test toggles still to do
+static uint32_t bootLedTimer;				// time of the next LED self-test toggle
+
+static const char * const bootCalNames[] = { "analog config", "measured", "cached" };
+#endif
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+#if BOOT_FAST
+static void bootLedToggleAll( void );
+#endif
+
+
+
+
+
+/****************************************************************************
+* Function Name    : bootMark
+* Date             : 10/19/2026
+* Description      : Records the time since reset at the end of a boot phase.
+* 						Phases beyond BOOT_MARKS are not recorded.
+*
+* Input Parameters : phase, name of the phase that just ended
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN bootMark
+void bootMark(const char *phase)
+{
+	uint32_t tick  = platformGetSysTick();
+	uint32_t cycle = platformGetCycleStamp();
+
+	if (bootMarkCount < BOOT_MARKS)
+	{
+		bootMarks[bootMarkCount].phase = phase;
+		bootMarks[bootMarkCount].us    = (tick * 1000U) + ((cycle * 1000U) / platformCycleStampPeriod());
+		bootMarkCount++;
+	}
+}
+// END bootMark
+
+
+
+
+
+/****************************************************************************
+* Function Name    : bootReport
+* Date             : 10/19/2026
+* Description      : Sends the boot phase timing, time since reset and since
+* 						the previous phase, and the source of the RF
+* 						calibration via the UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN bootReport
+void bootReport(void)
+{
+	uint8_t  i;
+	uint32_t prev = 0;
+
+	for (i = 0; i < bootMarkCount; i++)
+	{
+		platformLog("Boot %s: %lu us (+%lu)\r\n", bootMarks[i].phase,
+		            (unsigned long)bootMarks[i].us, (unsigned long)(bootMarks[i].us - prev));
+		prev = bootMarks[i].us;
+	}
+
+#if BOOT_FAST
+	platformLog("RF calibration: %s, rege %u\r\n", bootCalNames[bootCalState], bootCalRege);
+#endif
+}
+// END bootReport
+
+
+
+
+
+#if BOOT_FAST
+/****************************************************************************
+* Function Name    : bootLedStart
+* Date             : 10/19/2026
+* Description      : Starts the LED self-test with the first toggle.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN bootLedStart
+void bootLedStart(void)
+{
+	bootLedToggleAll();
+	bootLedLeft  = (BOOT_LED_TOGGLES - 1U);
+	bootLedTimer = platformTimerCreate(BOOT_LED_MS);
+}
+// END bootLedStart
+
+
+
+
+
+/****************************************************************************
+* Function Name    : bootLedTask
+* Date             : 10/19/2026
+* Description      : Toggles the LEDs when the next self-test step is due and
+* 						turns them all off after the last one. The tag LEDs
+* 						are lit again by the next detection.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN bootLedTask
+void bootLedTask(void)
+{
+	// IF the self-test is over or the next toggle is not due
+	if ((bootLedLeft == 0U) || !platformTimerIsExpired(bootLedTimer))
+	{
+		return;
+	}
+
+	bootLedLeft--;
+
+	if (bootLedLeft != 0U)
+	{
+		bootLedToggleAll();
+		bootLedTimer = platformTimerCreate(BOOT_LED_MS);
+	}
+	else
+	{
+		// Turn all LEDs Off
+		NFC06A1_LED_OFF( TA_LED );
+		NFC06A1_LED_OFF( TB_LED );
+		NFC06A1_LED_OFF( TF_LED );
+		NFC06A1_LED_OFF( TV_LED );
+		NFC06A1_LED_OFF( AP2P_LED );
+		NFC06A1_LED_OFF( TX_LED );
+	}
+}
+// END bootLedTask
+
+
+
+
+
+/****************************************************************************
+* Function Name    : bootCalLoad
+* Date             : 10/19/2026
+* Description      : Fetches the cached regulator calibration. Used by the
+* 						RFAL in place of the Adjust Regulators command.
+*
+* Input Parameters : supply, IO_CONF2 sup3V bit of the current supply
+* 					 rege, returns the cached regulator setting
+*
+* Return		   : true if a calibration for this supply is cached
+*
+*****************************************************************************/
+
+// BEGIN bootCalLoad
+bool bootCalLoad(uint8_t supply, uint8_t *rege)
+{
+	uint32_t word    = *(volatile const uint32_t *)BOOT_CAL_ADDR;
+	uint8_t  setting = (uint8_t)(word >> 8U);
+
+	// IF the word is not a calibration, is damaged or was measured at another supply
+	if ( ((uint8_t)word != BOOT_CAL_MAGIC) || ((uint8_t)(word >> 16U) != (uint8_t)~setting)
+	  || ((setting & BOOT_CAL_SUPPLY) != (supply & BOOT_CAL_SUPPLY)) )
+	{
+		return false;
+	}
+
+	*rege        = (setting & BOOT_CAL_REGE_MASK);
+	bootCalState = BOOT_CAL_CACHED;
+	bootCalRege  = *rege;
+	return true;
+}
+// END bootCalLoad
+
+
+
+
+
+/****************************************************************************
+* Function Name    : bootCalStore
+* Date             : 10/19/2026
+* Description      : Caches the result of the Adjust Regulators command in
+* 						the data EEPROM. The EEPROM is only written when the
+* 						setting changed, a write takes about 3 ms.
+*
+* Input Parameters : supply, IO_CONF2 sup3V bit of the current supply
+* 					 rege, regulator setting found by the command
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN bootCalStore
+void bootCalStore(uint8_t supply, uint8_t rege)
+{
+	uint8_t  setting = ((supply & BOOT_CAL_SUPPLY) | (rege & BOOT_CAL_REGE_MASK));
+	uint32_t word    = ((uint32_t)BOOT_CAL_MAGIC | ((uint32_t)setting << 8U) | ((uint32_t)(uint8_t)~setting << 16U));
+
+	bootCalState = BOOT_CAL_MEASURED;
+	bootCalRege  = (rege & BOOT_CAL_REGE_MASK);
+
+	if (*(volatile const uint32_t *)BOOT_CAL_ADDR != word)
+	{
+		if (HAL_FLASHEx_DATAEEPROM_Unlock() == HAL_OK)
+		{
+			// A failed write only costs the calibration on the next boot
+			(void)HAL_FLASHEx_DATAEEPROM_Program(FLASH_TYPEPROGRAMDATA_WORD, BOOT_CAL_ADDR, word);
+			(void)HAL_FLASHEx_DATAEEPROM_Lock();
+		}
+	}
+}
+// END bootCalStore
+
+
+
+
+
+/****************************************************************************
+* Function Name    : bootLedToggleAll
+* Date             : 10/19/2026
+* Description      : Toggles the six LEDs of the NFC board.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN bootLedToggleAll
+static void bootLedToggleAll( void )
+{
+	NFC06A1_LED_Toggle( TX_LED );
+	NFC06A1_LED_Toggle( TA_LED );
+	NFC06A1_LED_Toggle( TB_LED );
+	NFC06A1_LED_Toggle( TF_LED );
+	NFC06A1_LED_Toggle( TV_LED );
+	NFC06A1_LED_Toggle( AP2P_LED );
+}
+// END bootLedToggleAll
+#endif /* BOOT_FAST */
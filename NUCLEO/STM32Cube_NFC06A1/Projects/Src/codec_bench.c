@@ -0,0 +1,544 @@
+/*********************************************************************************
+* File Name :	codec_bench.c
+* Description: ISO15693 codec benchmark implementation file
+*		          Times rfalCrcCalculateCcitt, iso15693VCDCode and
+*		          iso15693VICCDecode on frames the size of the ones used while
+*		          programming a unit and checks each routine against a known
+*		          good frame. Triggered with the 'T' UART command on Debug
+*		          builds, so a change to the codec can be measured on the board
+*		          without an RF field or a tag.
+*		          The measured coding and decoding costs then feed a model of
+*		          the programming strategies (the current block_io flow,
+*		          single password session, batched writes, fast reads,
+*		          differential writes), which prints the RF transactions, bytes on air and
+*		          estimated air and CPU time of one unit for each of them.
+*
+*		          Air time model, high data rate, 1 out of 4, one subcarrier:
+*		          request byte 302 us, SOF 151 us, EOF 76 us; response byte,
+*		          SOF and EOF 151 us each, half of that for the ST fast
+*		          commands; t1 321 us and t2 309 us around each exchange and
+*		          5 ms of EEPROM programming per written block.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "codec_bench.h"
+#include "logger.h"
+#include "demo.h"
+#include "utils.h"
+#include "rfal_crc.h"
+#include "rfal_iso15693_2.h"
+#include "rfal_nfcv.h"
+#include "block_io.h"
+#include <string.h>
+
+#if DEBUG_OUTPUT
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define BENCH_TX_BLOCKS      8U     // blocks in the Write Multiple Blocks request that is coded
+#define BENCH_TX_LEN         (12U + (BENCH_TX_BLOCKS * 4U))              // flags, cmd, UID, first block, count, data
+#define BENCH_TX_CODED_LEN   (1U + ((BENCH_TX_LEN + 2U) * 4U) + 1U)      // SOF, 1 of 4 coded frame + CRC, EOF
+#define BENCH_RX_BLOCKS      32U    // blocks in the Read Multiple Blocks response that is decoded
+#define BENCH_RX_LEN         (1U + (BENCH_RX_BLOCKS * 4U) + 2U)          // flags, data, CRC
+#define BENCH_RX_STREAM_LEN  ((BENCH_RX_LEN * 2U) + 2U)                  // manchester stream incl. SOF and EOF
+#define BENCH_CRC_RESIDUE    0xF0B8U                                      // CCITT residue of a frame followed by its inverted CRC
+
+#define BENCH_VCD_SOF_US     151U   // request SOF, 1 out of 4
+#define BENCH_VCD_EOF_US     76U    // request EOF
+#define BENCH_VCD_BYTE_US    302U   // request byte, 1 out of 4
+#define BENCH_VICC_BYTE_US   151U   // response byte, SOF and EOF take the same, high data rate
+#define BENCH_T1_US          321U   // request to response
+#define BENCH_T2_US          309U   // response to next request
+#define BENCH_WRITE_US       5000U  // EEPROM programming time of one block
+#define BENCH_CRC_LEN        2U     // CRC on air in each direction
+#if DEMO_NFCV_USE_SELECT_MODE
+#define BENCH_ADDR_LEN       2U                                           // flags, command of a select mode request
+#else
+#define BENCH_ADDR_LEN       (2U + RFAL_NFCV_UID_LEN)                     // flags, command, UID of an addressed request
+#endif
+#define BENCH_SELECT_LEN     (2U + RFAL_NFCV_UID_LEN)                     // Select request, always addressed
+#define BENCH_UNIT_BLOCKS    (PROGRAM_LEN / BLOCK_SIZE)                   // blocks written per unit
+#define BENCH_SYSINFO_LEN    (1U + 1U + RFAL_NFCV_UID_LEN + 5U)           // flags, info flags, UID, DSFID, AFI, memory size, IC ref
+
+
+
+
+
+/* ------------------------- Private Types ------------------------- */
+typedef enum
+{
+	BENCH_STRAT_CURRENT,		// system information, one password, block_io write frames, one fast read back
+	BENCH_STRAT_ONE_PWD,		// one password for the unit, single block writes and reads
+	BENCH_STRAT_BATCHED,		// one password, Write and Read Multiple Blocks
+	BENCH_STRAT_FAST_READ,		// as batched, read back with Fast Read Multiple Blocks
+	BENCH_STRAT_DIFF_SAME,		// differential, tag already holds the recipe
+	BENCH_STRAT_DIFF_CHANGED,	// differential, every block changed
+	BENCH_STRAT_MAILBOX,		// mailbox on, Fast Write Message, MB_CTRL_Dyn read once the ICM took it
+	BENCH_STRAT_COUNT
+} BenchStrategy;
+
+typedef struct
+{
+	uint32_t transactions;	// RF exchanges
+	uint32_t bytes;			// bytes on air in both directions, CRC included
+	uint32_t airUs;			// estimated air time including EEPROM programming
+	uint32_t cpuUs;			// coding and decoding time from the measured costs
+} BenchCost;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static uint8_t benchFrame[BENCH_RX_LEN];            // plain frame, source of the coder and reference for the decoder
+static uint8_t benchStream[BENCH_RX_STREAM_LEN];    // coded or manchester stream, large enough for both directions
+static uint8_t benchDecoded[BENCH_RX_LEN];          // decoder output
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static void     benchPutBits( uint16_t *bitPos, uint8_t bits, uint8_t count );
+static uint16_t benchBuildRxStream( const uint8_t *frame, uint16_t frameLen );
+static uint32_t benchReport( const char *name, uint32_t iterations, uint32_t ms, uint16_t bytes );
+static void     benchExchange( BenchCost *c, uint16_t txLen, uint16_t rxLen, bool fast, uint16_t writeBlocks,
+                               uint32_t vcdNs, uint32_t viccNs );
+static ReturnCode benchStrategies( uint32_t vcdNs, uint32_t viccNs );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : codecBenchRun
+* Date             : 10/19/2026
+* Description      : Runs the ISO15693 codec benchmarks and golden frame checks
+* 						and prints the results via the UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : ERR_NONE if all golden frame checks passed and the
+* 					 current flow is within budget, ERR_INTERNAL otherwise
+*
+*****************************************************************************/
+
+// BEGIN codecBenchRun
+ReturnCode codecBenchRun(void)
+{
+	const struct iso15693StreamConfig *streamCfg;
+	iso15693PhyConfig_t savedCfg;
+	iso15693PhyConfig_t benchCfg;
+	ReturnCode err;
+	ReturnCode result = ERR_NONE;
+	uint32_t   start;
+	uint32_t   iterations;
+	uint16_t   crc;
+	uint16_t   i;
+	uint16_t   streamLen;
+	uint16_t   subbitLen;
+	uint16_t   offset;
+	uint16_t   codedLen;
+	uint16_t   decodedLen;
+	uint16_t   bitsBeforeCol;
+	uint32_t   vcdNs;
+	uint32_t   viccNs;
+
+	// Coding configuration is shared with the RF link, put it back when done
+	iso15693PhyGetConfiguration(&savedCfg);
+	benchCfg.coding    = ISO15693_VCD_CODING_1_4;
+	benchCfg.speedMode = 0;
+	iso15693PhyConfigure(&benchCfg, &streamCfg);
+
+	platformLog("Codec benchmark, core clock %lu Hz\r\n", (unsigned long)SystemCoreClock);
+
+	// Response frame: flags followed by a counting data pattern and its CRC
+	benchFrame[0] = 0x00;
+	for (i = 1; i < (BENCH_RX_LEN - 2U); i++)
+	{
+		benchFrame[i] = (uint8_t)(i * 7U);
+	}
+	crc = (uint16_t)~rfalCrcCalculateCcitt(0xFFFFU, benchFrame, (uint16_t)(BENCH_RX_LEN - 2U));
+	benchFrame[BENCH_RX_LEN - 2U] = (uint8_t)(crc & 0xFFU);
+	benchFrame[BENCH_RX_LEN - 1U] = (uint8_t)(crc >> 8U);
+
+	/* ---- CRC ---- */
+	// Golden check: a frame followed by its inverted CRC leaves the fixed residue
+	if (rfalCrcCalculateCcitt(0xFFFFU, benchFrame, (uint16_t)BENCH_RX_LEN) != BENCH_CRC_RESIDUE)
+	{
+		platformLog("CRC golden frame FAIL\r\n");
+		result = ERR_INTERNAL;
+	}
+
+	iterations = 0;
+	start = platformGetSysTick();
+	do
+	{
+		crc = rfalCrcCalculateCcitt(0xFFFFU, benchFrame, (uint16_t)BENCH_RX_LEN);
+		iterations++;
+	} while ((platformGetSysTick() - start) < CODEC_BENCH_MIN_MS);
+	benchReport("CRC", iterations, (platformGetSysTick() - start), (uint16_t)BENCH_RX_LEN);
+
+	/* ---- VCD coding ---- */
+	// Request frame: addressed Write Multiple Blocks, the coder sets the data rate flag itself
+	benchFrame[0] = 0x20;
+	benchFrame[1] = 0x24;
+	for (i = 2; i < BENCH_TX_LEN; i++)
+	{
+		benchFrame[i] = (uint8_t)(i * 13U);
+	}
+	benchFrame[10] = (uint8_t)(RECIPE_START_BLOCK + 1);
+	benchFrame[11] = (uint8_t)(BENCH_TX_BLOCKS - 1U);
+
+	offset = 0;
+	err = iso15693VCDCode(benchFrame, (uint16_t)BENCH_TX_LEN, true, true, false, &subbitLen, &offset,
+	                      benchStream, (uint16_t)sizeof(benchStream), &codedLen);
+
+	// Golden check: whole frame coded in one go, framed by SOF and EOF
+	if ( (err != ERR_NONE) || (codedLen != BENCH_TX_CODED_LEN) || (subbitLen != BENCH_TX_CODED_LEN)
+	  || (benchStream[0] != 0x21U) || (benchStream[codedLen - 1U] != 0x04U) )
+	{
+		platformLog("VCD golden frame FAIL (err %d, len %u)\r\n", err, codedLen);
+		result = ERR_INTERNAL;
+	}
+
+	iterations = 0;
+	start = platformGetSysTick();
+	do
+	{
+		offset = 0;
+		iso15693VCDCode(benchFrame, (uint16_t)BENCH_TX_LEN, true, true, false, &subbitLen, &offset,
+		                benchStream, (uint16_t)sizeof(benchStream), &codedLen);
+		iterations++;
+	} while ((platformGetSysTick() - start) < CODEC_BENCH_MIN_MS);
+	vcdNs = benchReport("VCD 1of4", iterations, (platformGetSysTick() - start), (uint16_t)(BENCH_TX_LEN + 2U));
+
+	/* ---- VICC decoding ---- */
+	// Rebuild the response frame, the request above reused the buffer
+	benchFrame[0] = 0x00;
+	for (i = 1; i < (BENCH_RX_LEN - 2U); i++)
+	{
+		benchFrame[i] = (uint8_t)(i * 7U);
+	}
+	crc = (uint16_t)~rfalCrcCalculateCcitt(0xFFFFU, benchFrame, (uint16_t)(BENCH_RX_LEN - 2U));
+	benchFrame[BENCH_RX_LEN - 2U] = (uint8_t)(crc & 0xFFU);
+	benchFrame[BENCH_RX_LEN - 1U] = (uint8_t)(crc >> 8U);
+
+	streamLen = benchBuildRxStream(benchFrame, (uint16_t)BENCH_RX_LEN);
+
+	err = iso15693VICCDecode(benchStream, streamLen, benchDecoded, (uint16_t)sizeof(benchDecoded),
+	                         &decodedLen, &bitsBeforeCol, 0, false);
+
+	// Golden check: clean decode with matching CRC and payload
+	if ( (err != ERR_NONE) || (decodedLen != BENCH_RX_LEN)
+	  || (memcmp(benchDecoded, benchFrame, BENCH_RX_LEN) != 0) )
+	{
+		platformLog("VICC golden frame FAIL (err %d, len %u)\r\n", err, decodedLen);
+		result = ERR_INTERNAL;
+	}
+
+	iterations = 0;
+	start = platformGetSysTick();
+	do
+	{
+		iso15693VICCDecode(benchStream, streamLen, benchDecoded, (uint16_t)sizeof(benchDecoded),
+		                   &decodedLen, &bitsBeforeCol, 0, false);
+		iterations++;
+	} while ((platformGetSysTick() - start) < CODEC_BENCH_MIN_MS);
+	viccNs = benchReport("VICC decode", iterations, (platformGetSysTick() - start), (uint16_t)BENCH_RX_LEN);
+
+	iso15693PhyConfigure(&savedCfg, &streamCfg);
+
+	if (benchStrategies(vcdNs, viccNs) != ERR_NONE)
+	{
+		result = ERR_INTERNAL;
+	}
+
+	platformLog("Codec benchmark %s\r\n", ((result == ERR_NONE) ? "PASS" : "FAIL"));
+
+	return result;
+}
+// END codecBenchRun
+
+
+
+
+
+/****************************************************************************
+* Function Name    : benchPutBits
+* Date             : 10/19/2026
+* Description      : Appends bits LSB first to the benchmark stream buffer.
+*
+* Input Parameters : bitPos, current bit position in benchStream, advanced
+* 					 bits, bits to append
+* 					 count, number of bits to append
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN benchPutBits
+static void benchPutBits( uint16_t *bitPos, uint8_t bits, uint8_t count )
+{
+	uint8_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		if (((bits >> i) & 0x01U) != 0U)
+		{
+			benchStream[*bitPos / 8U] |= (uint8_t)(1U << (*bitPos % 8U));
+		}
+		(*bitPos)++;
+	}
+}
+// END benchPutBits
+
+
+
+
+
+/****************************************************************************
+* Function Name    : benchBuildRxStream
+* Date             : 10/19/2026
+* Description      : Builds the manchester stream the ST25R3916 reports for a
+* 						VICC response: SOF, each data bit as a pair (01 for 0,
+* 						10 for 1, LSB first) and EOF.
+*
+* Input Parameters : frame, response frame including CRC
+* 					 frameLen, length of frame
+*
+* Return		   : number of stream bytes written to benchStream
+*
+*****************************************************************************/
+
+// BEGIN benchBuildRxStream
+static uint16_t benchBuildRxStream( const uint8_t *frame, uint16_t frameLen )
+{
+	uint16_t bitPos = 0;
+	uint16_t i;
+	uint8_t  b;
+
+	ST_MEMSET(benchStream, 0, sizeof(benchStream));
+
+	benchPutBits(&bitPos, 0x17U, 5U);                                   // SOF
+	for (i = 0; i < frameLen; i++)
+	{
+		for (b = 0; b < 8U; b++)
+		{
+			benchPutBits(&bitPos, ((((frame[i] >> b) & 0x01U) != 0U) ? 0x02U : 0x01U), 2U);
+		}
+	}
+	benchPutBits(&bitPos, 0x1DU, 8U);                                   // EOF: 1,0,1,1,1,0,0,0
+
+	return (uint16_t)((bitPos + 7U) / 8U);
+}
+// END benchBuildRxStream
+
+
+
+
+
+/****************************************************************************
+* Function Name    : benchReport
+* Date             : 10/19/2026
+* Description      : Prints the throughput of one benchmark.
+*
+* Input Parameters : name, benchmark name
+* 					 iterations, number of frames processed
+* 					 ms, elapsed time
+* 					 bytes, frame length in bytes
+*
+* Return		   : cost in ns per byte
+*
+*****************************************************************************/
+
+// BEGIN benchReport
+static uint32_t benchReport( const char *name, uint32_t iterations, uint32_t ms, uint16_t bytes )
+{
+	uint32_t nsPerByte;
+	uint32_t cyclesPerFrame;
+
+	nsPerByte      = (uint32_t)(((uint64_t)ms * 1000000U) / ((uint64_t)iterations * bytes));
+	cyclesPerFrame = (uint32_t)(((uint64_t)ms * (SystemCoreClock / 1000U)) / iterations);
+
+	platformLog("%s: %lu frames of %u bytes in %lu ms, %lu ns/byte, %lu cycles/frame\r\n",
+	            name, (unsigned long)iterations, bytes, (unsigned long)ms,
+	            (unsigned long)nsPerByte, (unsigned long)cyclesPerFrame);
+
+	return nsPerByte;
+}
+// END benchReport
+
+
+
+
+
+/****************************************************************************
+* Function Name    : benchExchange
+* Date             : 10/19/2026
+* Description      : Adds one modelled request and response to a strategy.
+*
+* Input Parameters : c, cost of the strategy, updated
+* 					 txLen, request length without CRC
+* 					 rxLen, response length without CRC
+* 					 fast, response sent at the doubled data rate
+* 					 writeBlocks, blocks programmed into the EEPROM
+* 					 vcdNs, measured request coding cost per byte
+* 					 viccNs, measured response decoding cost per byte
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN benchExchange
+static void benchExchange( BenchCost *c, uint16_t txLen, uint16_t rxLen, bool fast, uint16_t writeBlocks,
+                           uint32_t vcdNs, uint32_t viccNs )
+{
+	uint32_t txBytes = ((uint32_t)txLen + BENCH_CRC_LEN);
+	uint32_t rxBytes = ((uint32_t)rxLen + BENCH_CRC_LEN);
+	uint32_t rxUs    = ((rxBytes + 2U) * BENCH_VICC_BYTE_US);	// SOF and EOF last one byte each
+
+	c->transactions++;
+	c->bytes += (txBytes + rxBytes);
+	c->airUs += BENCH_VCD_SOF_US + (txBytes * BENCH_VCD_BYTE_US) + BENCH_VCD_EOF_US
+	          + BENCH_T1_US + (fast ? (rxUs / 2U) : rxUs) + BENCH_T2_US
+	          + ((uint32_t)writeBlocks * BENCH_WRITE_US);
+	c->cpuUs += (((txBytes * vcdNs) + (rxBytes * viccNs)) / 1000U);
+}
+// END benchExchange
+
+
+
+
+
+/****************************************************************************
+* Function Name    : benchStrategies
+* Date             : 10/19/2026
+* Description      : Models one unit for each programming strategy and prints
+* 						the comparison table. The current flow must stay
+* 						within CODEC_BENCH_UNIT_BUDGET_US, a slower codec or
+* 						a longer flow fails the benchmark.
+*
+* Input Parameters : vcdNs, measured request coding cost per byte
+* 					 viccNs, measured response decoding cost per byte
+*
+* Return		   : ERR_NONE if the current flow is within budget,
+* 					 ERR_TIMEOUT otherwise
+*
+*****************************************************************************/
+
+// BEGIN benchStrategies
+static ReturnCode benchStrategies( uint32_t vcdNs, uint32_t viccNs )
+{
+	// Request lengths without CRC, responses are the flags byte plus data
+	const uint16_t pwdLen   = (BENCH_ADDR_LEN + 2U + PWD_SIZE);           // + IC code, password number
+	const uint16_t wrLen    = (BENCH_ADDR_LEN + 1U + BLOCK_SIZE);         // + block
+	const uint16_t rdLen    = (BENCH_ADDR_LEN + 1U);                      // + block
+	const uint16_t wrMulLen = (BENCH_ADDR_LEN + 2U + PROGRAM_LEN);        // + first block, count
+	const uint16_t rdMulLen = (BENCH_ADDR_LEN + 2U);                      // + first block, count
+	const uint16_t fastLen  = (BENCH_ADDR_LEN + 3U);                      // + IC code, first block, count
+	const uint16_t dynRdLen = (BENCH_ADDR_LEN + 2U);                      // + IC code, pointer
+	const uint16_t dynWrLen = (BENCH_ADDR_LEN + 3U);                      // + IC code, pointer, value
+	const uint16_t msgLen   = (BENCH_ADDR_LEN + 2U + PROGRAM_LEN);        // + IC code, length
+
+	static const char * const names[BENCH_STRAT_COUNT] =
+	{ "Current", "One password", "Batched", "Batched fast read", "Differential same", "Differential changed", "Mailbox" };
+
+	BenchCost c;
+	uint8_t   s;
+	uint16_t  b;
+	uint16_t  n;
+
+	platformLog("strategy,transactions,bytesOnAir,airUs,cpuUs,totalUs\r\n");
+
+	for (s = 0; s < (uint8_t)BENCH_STRAT_COUNT; s++)
+	{
+		ST_MEMSET(&c, 0, sizeof(c));
+
+#if DEMO_NFCV_USE_SELECT_MODE
+		// Each unit is selected once, the requests then go without UID
+		benchExchange(&c, BENCH_SELECT_LEN, 1U, false, 0U, vcdNs, viccNs);
+#endif
+
+		switch ((BenchStrategy)s)
+		{
+			case BENCH_STRAT_CURRENT:
+				benchExchange(&c, BENCH_ADDR_LEN, BENCH_SYSINFO_LEN, false, 0U, vcdNs, viccNs);
+				benchExchange(&c, pwdLen, 1U, false, 0U, vcdNs, viccNs);
+				for (b = 0; b < BENCH_UNIT_BLOCKS; b += n)
+				{
+					// Frames as block_io plans them for the ST25DV
+					n = (uint16_t)MIN((BENCH_UNIT_BLOCKS - b), BLOCK_IO_WRITE_BLOCKS);
+					benchExchange(&c, ((n == 1U) ? wrLen : (uint16_t)(BENCH_ADDR_LEN + 2U + (n * BLOCK_SIZE))), 1U, false, n, vcdNs, viccNs);
+				}
+#if BLOCK_IO_FAST_READ
+				benchExchange(&c, fastLen, (1U + PROGRAM_LEN), true, 0U, vcdNs, viccNs);
+#else
+				benchExchange(&c, rdMulLen, (1U + PROGRAM_LEN), false, 0U, vcdNs, viccNs);
+#endif
+				break;
+
+			case BENCH_STRAT_ONE_PWD:
+				benchExchange(&c, pwdLen, 1U, false, 0U, vcdNs, viccNs);
+				for (b = 0; b < BENCH_UNIT_BLOCKS; b++)
+				{
+					benchExchange(&c, wrLen, 1U, false, 1U, vcdNs, viccNs);
+				}
+				for (b = 0; b < BENCH_UNIT_BLOCKS; b++)
+				{
+					benchExchange(&c, rdLen, (1U + BLOCK_SIZE), false, 0U, vcdNs, viccNs);
+				}
+				break;
+
+			case BENCH_STRAT_BATCHED:
+				benchExchange(&c, pwdLen, 1U, false, 0U, vcdNs, viccNs);
+				benchExchange(&c, wrMulLen, 1U, false, BENCH_UNIT_BLOCKS, vcdNs, viccNs);
+				benchExchange(&c, rdMulLen, (1U + PROGRAM_LEN), false, 0U, vcdNs, viccNs);
+				break;
+
+			case BENCH_STRAT_FAST_READ:
+				benchExchange(&c, pwdLen, 1U, false, 0U, vcdNs, viccNs);
+				benchExchange(&c, wrMulLen, 1U, false, BENCH_UNIT_BLOCKS, vcdNs, viccNs);
+				benchExchange(&c, fastLen, (1U + PROGRAM_LEN), true, 0U, vcdNs, viccNs);
+				break;
+
+			case BENCH_STRAT_DIFF_SAME:
+				benchExchange(&c, fastLen, (1U + PROGRAM_LEN), true, 0U, vcdNs, viccNs);
+				break;
+
+			case BENCH_STRAT_DIFF_CHANGED:
+				benchExchange(&c, fastLen, (1U + PROGRAM_LEN), true, 0U, vcdNs, viccNs);
+				benchExchange(&c, pwdLen, 1U, false, 0U, vcdNs, viccNs);
+				benchExchange(&c, wrMulLen, 1U, false, BENCH_UNIT_BLOCKS, vcdNs, viccNs);
+				benchExchange(&c, fastLen, (1U + PROGRAM_LEN), true, 0U, vcdNs, viccNs);
+				break;
+
+			case BENCH_STRAT_MAILBOX:
+			default:
+				// ICM reading the message within one MB_CTRL_Dyn read, its own time not counted
+				benchExchange(&c, dynRdLen, 2U, true, 0U, vcdNs, viccNs);
+				benchExchange(&c, dynWrLen, 1U, true, 0U, vcdNs, viccNs);
+				benchExchange(&c, msgLen, 1U, true, 0U, vcdNs, viccNs);
+				benchExchange(&c, dynRdLen, 2U, true, 0U, vcdNs, viccNs);
+				break;
+		}
+
+		platformLog("%s,%lu,%lu,%lu,%lu,%lu\r\n", names[s], (unsigned long)c.transactions, (unsigned long)c.bytes,
+		            (unsigned long)c.airUs, (unsigned long)c.cpuUs, (unsigned long)(c.airUs + c.cpuUs));
+
+		// Only the flow actually used is held to the budget
+		if ((s == (uint8_t)BENCH_STRAT_CURRENT) && ((c.airUs + c.cpuUs) > CODEC_BENCH_UNIT_BUDGET_US))
+		{
+			platformLog("Current flow over budget of %lu us\r\n", (unsigned long)CODEC_BENCH_UNIT_BUDGET_US);
+			return ERR_TIMEOUT;
+		}
+	}
+
+	return ERR_NONE;
+}
+// END benchStrategies
+
+#endif /* DEBUG_OUTPUT */
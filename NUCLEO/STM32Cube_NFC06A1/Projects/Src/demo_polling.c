@@ -36,6 +36,17 @@
 #include "rfal_st25xv.h"
 #include "logger.h"
 #include "icm_models.h"
+#include "codec_bench.h"
+#include "stats.h"
+#include "trace.h"
+#include "rf_probe.h"
+#include "st25r3916_com.h"
+#include "boot.h"
+#include "ram_probe.h"
+#include "uid_history.h"
+#include "block_io.h"
+#include "mailbox.h"
+#include "rfal_crc.h"
 
 #if (defined(ST25R3916) || defined(ST25R95)) && RFAL_FEATURE_LISTEN_MODE
 #include "demo_ce.h"
@@ -120,14 +131,83 @@ static uint8_t payLoad_RF_AREA_1_PWD[PWD_SIZE] =
 // compared to the program sent over UART.
 uint8_t written[PROGRAM_LEN];
 
+// The unit being programmed answered the Select command, its requests go without UID
+static bool nfcvSelected;
+
+// Units programmed, forgotten once the fixture is found empty
+static uint8_t quietUIDs[DEMO_QUIET_UNITS][RFAL_NFCV_UID_LEN];
+static uint8_t quietCount;      // entries of quietUIDs in use
+static uint8_t quietNext;       // entry replaced by the next unit once the table is full
+
+#if (DEMO_GANG_UNITS > 1U)
+#define GANG_JOB_WRITE      0U      // recipe blocks being written
+#define GANG_JOB_VERIFY     1U      // recipe blocks being read back
+#define GANG_JOB_PASS       2U      // unit programmed and verified
+#define GANG_JOB_FAIL       3U      // unit given up
+#define GANG_RETRY_MS       1000U   // a failing unit is left alone this long, the others go on
+
+// One unit of a gang programming cycle
+typedef struct
+{
+    uint8_t  uid[RFAL_NFCV_UID_LEN];    // UID as received in the inventory
+    uint8_t  state;                     // GANG_JOB_xxx
+    uint8_t  fails;                     // failures of the recipe write
+    bool     pwdOk;                     // area 1 password presented in this session
+    bool     known;                     // history says the unit holds the recipe, written only if the read back differs
+    uint32_t retryTick;                 // tick of the next attempt after a failure
+} GangJob;
+
+static GangJob gangJobs[DEMO_GANG_UNITS];   // units found in the field
+#endif
+
+#define CONFIG_RFA1SS       0x04U   // static register pointer of the RF area 1 security status
+#define CONFIG_PWD_CFG      0U      // RF configuration password number
+#define CONFIG_PWD_AREA1    1U      // RF area 1 password number
+
+// Security configuration a unit is brought to. RFA1SS is written last, once
+// both passwords are in place, so it alone tells whether a unit is in it.
+typedef struct
+{
+    uint8_t        rfa1ss;          // RFA1SS value
+    const uint8_t *pwd[2];          // configuration and area 1 passwords to set
+    const uint8_t *from[2];         // configuration and area 1 passwords the unit has otherwise
+} ConfigTarget;
+
+// Area 1 write protected by its password, as factoryInitializer leaves the unit
+static const ConfigTarget configFactory =
+{
+    0x05, { payLoad_RF_CONFIG_PWD, payLoad_RF_AREA_1_PWD }, { payLoad_DEF_PWD, payLoad_DEF_PWD }
+};
+
+// ST25DV factory default, as deInitializer leaves the unit
+static const ConfigTarget configDefault =
+{
+    0x00, { payLoad_DEF_PWD, payLoad_DEF_PWD }, { payLoad_RF_CONFIG_PWD, payLoad_RF_AREA_1_PWD }
+};
+
 /* ------------------------- Private Function Prototypes ------------------------- */
 uint8_t tagFinder( void );
 static uint8_t deInitializer( rfalNfcvListenDevice *nfcvDev );
 static uint8_t writeConfiguration( rfalNfcvListenDevice *nfcvDev);
 static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev);
+static ReturnCode configSync( uint8_t reqFlag, const uint8_t *uid, const ConfigTarget *target );
 static uint8_t processCommand( rfalNfcvListenDevice *nfcvDev );
 static uint8_t initializeTest( rfalNfcvListenDevice * nfcvDev );
 static uint8_t checkReply( rfalNfcvListenDevice * nfcvDev );
+static uint8_t recipeVerify( rfalNfcvListenDevice *nfcvDev );
+static void selectUnit( rfalNfcvListenDevice *nfcvDev );
+static void unitAddressing( rfalNfcvListenDevice *nfcvDev, uint8_t *reqFlag, uint8_t **uid );
+static void unitFallback( rfalNfcvListenDevice *nfcvDev, uint8_t *reqFlag, uint8_t **uid );
+static void unitQuiet( const uint8_t *uid );
+static bool unitIsQuiet( const uint8_t *uid );
+static uint8_t programTarget( void );
+#if UID_HISTORY
+static uint16_t recipeHash( void );
+#endif
+#if (DEMO_GANG_UNITS > 1U)
+static uint8_t gangProgram( void );
+static bool gangStep( GangJob *job );
+#endif
 /*static void demoP2P( rfalNfcDevice *nfcDev );
 static void demoAPDU( void );
 static void demoNfcv( rfalNfcvListenDevice *nfcvDev );
@@ -154,6 +234,7 @@ ReturnCode  demoTransceiveBlocking( uint8_t *txBuf, uint16_t txBufSize, uint8_t
 static void demoNotif( rfalNfcState st )
 {
     uint8_t       devCnt;
+    uint8_t       i;
     rfalNfcDevice *dev;
 
 
@@ -167,11 +248,19 @@ static void demoNotif( rfalNfcState st )
     }
     else if( st == RFAL_NFC_STATE_POLL_SELECT )
     {
-        /* Multiple devices were found, activate first of them */
+        /* Multiple devices were found, activate the first one still needing work. Gang programming addresses all of them */
         rfalNfcGetDevicesFound( &dev, &devCnt );
-        rfalNfcSelect( 0 );
 
-        platformLog("Multiple Tags detected: %d \r\n", devCnt);
+        for( i = 0; i < devCnt; i++ )
+        {
+            if( (dev[i].type == RFAL_NFC_LISTEN_TYPE_NFCV) && !unitIsQuiet( dev[i].dev.nfcv.InvRes.UID ) )
+            {
+                break;
+            }
+        }
+        rfalNfcSelect( ((i < devCnt) ? i : 0U) );
+
+        DEBUG_LOG("Multiple Tags detected: %d \r\n", devCnt);
     }
 }
 // END demoNotif()
@@ -198,7 +287,7 @@ bool init_TagFinder( void )
     if( err == ERR_NONE )
     {
         discParam.compMode      = RFAL_COMPLIANCE_MODE_NFC;
-        discParam.devLimit      = 1U;
+        discParam.devLimit      = DEMO_GANG_UNITS;
         discParam.nfcfBR        = RFAL_BR_212;
         discParam.ap2pBR        = RFAL_BR_424;
         discParam.maxBR         = RFAL_BR_KEEP;
@@ -261,9 +350,11 @@ bool init_TagFinder( void )
 #endif /* ST25R3916 */
 #endif /* RFAL_FEATURE_LISTEN_MODE */
 
-        /* Check for valid configuration by calling Discover once */
+#if !BOOT_FAST
+        /* Check for valid configuration by calling Discover once. With BOOT_FAST the first Discover of the tag finder checks it */
         err = rfalNfcDiscover( &discParam );
         rfalNfcDeactivate( false );
+#endif
 
         if( err != ERR_NONE )
         {
@@ -280,6 +371,7 @@ bool init_TagFinder( void )
 
 
 
+
 /***********************************************************************************************************************
 * Function Name      : tagFinder
 * Creation Date      : 8/11/2022
@@ -303,6 +395,7 @@ uint8_t tagFinder( void )
     //variables
     static rfalNfcDevice *nfcDevice;	// NFC device detected within the Add On Boards RF field
     static uint8_t       writeArmed;	// boolean variable used to gate write actions in conjunction w/ a push button
+    rfalNfcState         nfcState;      // state of the RFAL discovery before the worker ran
     uint8_t              error = 0;     // signifies if an RF write error occurred or not. 0 is no error, assume success
 
 /************************************************ BEGIN FUNCTION ************************************************/
@@ -310,6 +403,10 @@ uint8_t tagFinder( void )
     // IF the flag signifying a message has been received is set to true
     if (g_bMsgReceived == 1)
     {
+#if RAM_PROBE
+    	ramProbePathStart();
+#endif
+
     	// reset flag to false
     	g_bMsgReceived = 0;
 
@@ -319,13 +416,103 @@ uint8_t tagFinder( void )
         // Write Rx Data to Console
         DEBUG_LOG("Data: %s\r\n", hex2Str(g_Rx_Data, sizeof(g_Rx_Data)));
 
-       	// Set Write Tag Flag to true
-       	writeArmed = 1;
+        // Record complete commands, not every byte of a program
+        if (command != NONE)
+        {
+        	traceUart(TRACE_UART_RX, (uint8_t)command);
+        }
+
+        // IF the command does not need a tag, run it now with the RF link idle
+        if (command == STATS)
+        {
+        	command = NONE;
+        	statsReport();
+        }
+        else if (command == DUMP_TRACE)
+        {
+        	command = NONE;
+        	traceDump();
+        }
+#if RF_PROBE
+        else if (command == RF_COUNTERS)
+        {
+        	command = NONE;
+        	rfProbeReport();
+        }
+#endif
+#if RAM_PROBE
+        else if (command == RAM_REPORT)
+        {
+        	command = NONE;
+        	ramProbeReport();
+        }
+#endif
+#if DEBUG_OUTPUT
+        else if (command == BENCHMARK)
+        {
+        	command = NONE;
+        	rfalNfcDeactivate( false );
+        	codecBenchRun();
+        }
+        else if (command == FAULT_CONFIG)
+        {
+        	// Start a new fault scenario with clean statistics
+        	command = NONE;
+        	faultInjectConfigure(faultConfig);
+        	statsReset();
+        	platformLog("Fault injection: %s\r\n", hex2Str(faultConfig, FAULT_CONFIG_LEN));
+        }
+#endif
+        else if (command == PROGRAM_UID)
+        {
+        	// The unit is looked for by its UID, no discovery cycle needed
+        	statsUnitArmed();
+        	writeArmed = 0;
+        	error = programTarget();
+        	command = NONE;
+        }
+        else
+        {
+        	// Start timing the unit once the whole program has been received
+        	if (command == PROGRAM)
+        	{
+        		statsUnitArmed();
+        	}
+
+        	// Set Write Tag Flag to true
+        	writeArmed = 1;
+        }
+        // END IF
+
+#if RAM_PROBE
+        ramProbePathEnd(RAM_PATH_COMMAND);
+#endif
     }
     // END IF
 
     /* Run RFAL worker periodically */
+#if RAM_PROBE
+    ramProbePathStart();
+#endif
+    nfcState = rfalNfcGetState();
+#ifdef ST25R_COM_PROFILE
+    uint8_t spiPhase = st25r3916comSetPhase(ST25R3916_COM_PHASE_DISCOVERY);
     rfalNfcWorker();
+    st25r3916comSetPhase(spiPhase);
+#else
+    rfalNfcWorker();
+#endif
+#if RAM_PROBE
+    ramProbePathEnd(RAM_PATH_DISCOVERY);
+#endif
+
+    // IF technology detection ended without any tag, the programmed units were taken off the fixture
+    if ((nfcState == RFAL_NFC_STATE_POLL_TECHDETECT) && (rfalNfcGetState() == RFAL_NFC_STATE_LISTEN_TECHDETECT))
+    {
+        quietCount = 0;
+        quietNext  = 0;
+    }
+    // END IF
 
     //BEGIN SWITCH g_DiscovState
     switch( g_DiscovState )
@@ -347,7 +534,15 @@ uint8_t tagFinder( void )
 			rfalNfcDeactivate( false );
 
 			// call function to start NFC Discovery
-			rfalNfcDiscover( &discParam );
+			// IF RFAL refused the discovery parameters, stop the tag finder as a failed initialization would
+			if (rfalNfcDiscover( &discParam ) != ERR_NONE)
+			{
+				DEBUG_LOG("Discovery parameters refused\r\n");
+				g_DiscovState = DEMO_ST_NOTINIT;
+				error = WRITE_FAIL;
+				break;
+			}
+			// END IF
 
             // change state to discovery mode
 			g_DiscovState = DEMO_ST_DISCOVERY;
@@ -395,6 +590,12 @@ uint8_t tagFinder( void )
 								// Light the LED for NFC-V
 								platformLedOn(PLATFORM_LED_V_PORT, PLATFORM_LED_V_PIN);
 
+								// IF the unit was programmed already, it is not handled again and the command waits for the next unit
+								if (unitIsQuiet(nfcDevice->dev.nfcv.InvRes.UID))
+								{
+									break;
+								}
+
 								// IF Write Flag is true
 								if (writeArmed == 1)
 								{
@@ -402,7 +603,13 @@ uint8_t tagFinder( void )
 									writeArmed = 0;
 
 									// call factory initializer to write to part
+#if RAM_PROBE
+									ramProbePathStart();
 									error = processCommand( &nfcDevice->dev.nfcv );
+									ramProbePathEnd(RAM_PATH_PROGRAM);
+#else
+									error = processCommand( &nfcDevice->dev.nfcv );
+#endif
 								}
 								// END IF
 
@@ -493,6 +700,17 @@ uint8_t tagFinder( void )
 						// BREAK
 						break;
 
+					// CASE NFC-V, programmed units are skipped instead of waited out
+					case RFAL_NFC_LISTEN_TYPE_NFCV:
+
+						if (!unitIsQuiet(nfcDevice->dev.nfcv.InvRes.UID))
+						{
+							platformDelay(500);
+						}
+
+						// BREAK
+						break;
+
 					// DEFAULT
 					default:
 						/* Delay before re-starting polling loop to not flood the UART log with re-discovered tags */
@@ -549,6 +767,9 @@ static uint8_t processCommand( rfalNfcvListenDevice *nfcvDev )
 
     // variables
 	uint8_t error       = 0;	// container for error codes, 0 for no error
+#if UID_HISTORY
+	uint8_t history;			// UID_HISTORY_xxx state of the unit
+#endif
 
 
 
@@ -575,7 +796,8 @@ static uint8_t processCommand( rfalNfcvListenDevice *nfcvDev )
 
         /*******************************************************************************/
         // CASE Program
-        case PROGRAM: ;
+        case PROGRAM:
+        case PROGRAM_UID: ;
         	uint8_t checksum = 0;
 
             for (int i = 0; i < PROGRAM_LEN; i++)
@@ -587,13 +809,50 @@ static uint8_t processCommand( rfalNfcvListenDevice *nfcvDev )
             {
                 platformLog("CHECKSUM_ERR\n");
             }
+#if (DEMO_GANG_UNITS > 1U)
+            else if (command == PROGRAM)
+            {
+                // Every unit in the field is programmed and reports its own result
+                error = gangProgram();
+            }
+#endif
             else
             {
-                error = writeConfiguration(nfcvDev);
+                statsUnitWriteStart();
+                selectUnit(nfcvDev);
+#if UID_HISTORY
+                history = uidHistoryCheck(nfcvDev->InvRes.UID, recipeHash());
+                uidHistoryFlag(nfcvDev->InvRes.UID, history);
+
+                // Unit already holding this recipe, acknowledged after reading it back instead of writing it again
+                if ((history == UID_HISTORY_DONE) && (recipeVerify(nfcvDev) == WRITE_PASS))
+                {
+                    DEBUG_LOG("Unit already programmed\r\n");
+                    error = WRITE_PASS;
+                }
+                else
+#endif
+                {
+                    error = writeConfiguration(nfcvDev);
+                }
+                nfcvSelected = false;   // select mode only holds for this unit
+#if UID_HISTORY
+                uidHistoryStore(nfcvDev->InvRes.UID, recipeHash(), (error == 0));
+#endif
+
+                if (error == 0)
+                {
+                    unitQuiet(nfcvDev->InvRes.UID);
+                }
+                statsUnitWriteDone();
 
                 // Delay to allow UTF to Catch Up
                 platformDelay(1000);
 
+                statsUnitDone(error == 0);
+
+                traceUart(TRACE_UART_TX, error);
+
                 if (error == 0)
                 {
                     // No errors, transmit Pass status to UTF
@@ -631,151 +890,607 @@ static uint8_t processCommand( rfalNfcvListenDevice *nfcvDev )
 
 
 
+/*********************************************************************************
+* Function Name    : selectUnit
+* Date             : 10/19/2026
+* Description      : Puts the unit in the Selected state once before it is
+* 					  programmed, so the following requests can be sent in
+* 					  select mode, 8 UID bytes shorter each. A unit that does
+* 					  not answer is programmed in addressed mode.
+*
+*  Input Parameters: nfcvDev, a pointer to an NFC Device Structure
+*  Return          : none
+*********************************************************************************/
+
+// BEGIN selectUnit()
+static void selectUnit( rfalNfcvListenDevice *nfcvDev )
+{
+    nfcvSelected = false;
+
+#if DEMO_NFCV_USE_SELECT_MODE
+    nfcvSelected = (rfalNfcvPollerSelect(RFAL_NFCV_REQ_FLAG_DEFAULT, nfcvDev->InvRes.UID) == ERR_NONE);
+    DEBUG_LOG("Select: %s\r\n", nfcvSelected ? "OK" : "FAIL, addressed mode");
+#endif
+}
+// END selectUnit()
+
+
 
 
 
-/****************************************************************************
-* Function Name    : initializeTest
-* Date             : 02/10/2023
-* Author           : Paul E. Fritzen
-* Description      : Checks for Virgin State at Block 55 and re-virginizes
-* 						NFC Chip of not virgin. Writes factory initialization
-* 						flag into Block 60.
+/*********************************************************************************
+* Function Name    : unitAddressing
+* Date             : 10/19/2026
+* Description      : Gives the request flags and UID to send to the unit:
+* 					  select mode once selectUnit succeeded, addressed mode
+* 					  otherwise.
 *
 *  Input Parameters: nfcvDev, a pointer to an NFC Device Structure
-*  Return          : error, signifies an error occurred if not 0 or no error
-*  					  occurred if 0
-*****************************************************************************/
+* 					 reqFlag, returns the request flags
+* 					 uid, returns the UID to send, NULL in select mode
+*  Return          : none
+*********************************************************************************/
 
-// BEGIN initializeTest function
-static uint8_t initializeTest( rfalNfcvListenDevice * nfcvDev )
+// BEGIN unitAddressing()
+static void unitAddressing( rfalNfcvListenDevice *nfcvDev, uint8_t *reqFlag, uint8_t **uid )
 {
-    //constants
+    if (nfcvSelected)
+    {
+        *reqFlag = (RFAL_NFCV_REQ_FLAG_DEFAULT | RFAL_NFCV_REQ_FLAG_SELECT);
+        *uid     = NULL;
+    }
+    else
+    {
+        *reqFlag = RFAL_NFCV_REQ_FLAG_DEFAULT;
+        *uid     = nfcvDev->InvRes.UID;
+    }
+}
+// END unitAddressing()
 
-    //variables
-    ReturnCode error;                  // return code for errors. IF 0 then there are no errors
-    uint8_t    blockNum;               // keeps track of the block number to be written to during initialization
-    uint8_t    *uid;                   // Unique Identifier of an NFC tag found within the antenna's field
-    uint8_t    reqFlag;                // Request Flag, used to tell Middleware Functions we are working with an NFC-V Tag
-    uint8_t    blockLength;            // length of a block of data. For the st25dv04k this will always be 4 bytes.
-    uint8_t    byteCounter     = 0;    // counter used to track number of bytes loaded into write/read array
-    uint8_t    matchCounter    = 0;    // counter used to track number of matching bytes read in de-virginized marker
-    uint8_t    failureCounter  = 0;    // counter used to track number of times write/read has failed
-    uint8_t    transmitSuccess = 0;    // sentinel boolean used to gate guard against transmission failure
-    uint16_t   rcvLen;				   // placeholder variable for receiving Acknowledgment from lower level functions
 
-    uint8_t    rxBuf[ 1 + DEMO_NFCV_BLOCK_LEN + RFAL_CRC_LEN ];		/* Flags + Block Data + CRC */
 
-    // placeholder Test Flag File
-    static uint8_t testFlag[BLOCK_SIZE] =
+
+
+/*********************************************************************************
+* Function Name    : unitFallback
+* Date             : 10/19/2026
+* Description      : Leaves select mode after a failed request. A unit that
+* 					  lost power in the field is back in the Ready state and
+* 					  ignores select mode requests, so the retries go in
+* 					  addressed mode for the rest of the unit.
+*
+*  Input Parameters: nfcvDev, a pointer to an NFC Device Structure
+* 					 reqFlag, returns the request flags
+* 					 uid, returns the UID to send
+*  Return          : none
+*********************************************************************************/
+
+// BEGIN unitFallback()
+static void unitFallback( rfalNfcvListenDevice *nfcvDev, uint8_t *reqFlag, uint8_t **uid )
+{
+    if (nfcvSelected)
     {
-        'T', 'E', 'S', 'T'
-    };
+        DEBUG_LOG("Select mode failed, addressed mode\r\n");
+    }
 
-    // De-virginized Marker
-    static uint8_t factoryStamp[BLOCK_SIZE] = FACTORY_STAMP;
+    nfcvSelected = false;
+    unitAddressing(nfcvDev, reqFlag, uid);
+}
+// END unitFallback()
 
-/**************************************** BEGIN FUNCTION ****************************************/
 
-    // set first block number to read from Block 55 to look for the DV Mark
-    blockNum = STAMP_BLOCK;
 
-    // set UID
-    uid = nfcvDev->InvRes.UID;
 
-    // set flag showing NFC Standard in use is NFC-V/ISO 15693
-    reqFlag = RFAL_NFCV_REQ_FLAG_DEFAULT;
 
-    // set block Length
-    blockLength = BLOCK_SIZE;
+/*********************************************************************************
+* Function Name    : unitQuiet
+* Date             : 10/19/2026
+* Description      : Remembers the UID of a programmed unit. The field is
+* 					  turned off between two polling cycles, so the unit
+* 					  answers every inventory again; the UID keeps it from
+* 					  being activated or programmed again while it is left
+* 					  on the fixture.
+*
+*  Input Parameters: uid, UID of the unit as received in the inventory
+*  Return          : none
+*********************************************************************************/
 
-    /********** BEGIN Check If Initialized **********/
+// BEGIN unitQuiet()
+static void unitQuiet( const uint8_t *uid )
+{
+    if (unitIsQuiet(uid))
+    {
+        return;
+    }
 
-    // DO
-    do
+    ST_MEMCPY(quietUIDs[quietNext], uid, RFAL_NFCV_UID_LEN);
+    quietNext = ((quietNext + 1U) % DEMO_QUIET_UNITS);
+    if (quietCount < DEMO_QUIET_UNITS)
     {
-        // read Test Flag Block
-        error = rfalNfcvPollerReadSingleBlock(reqFlag, uid, blockNum, rxBuf, sizeof(rxBuf), &rcvLen);
+        quietCount++;
+    }
+}
+// END unitQuiet()
 
-        // log output
-        DEBUG_LOG(" Read Marker: %s %s\r\n", (error != ERR_NONE) ? "FAIL": "OK Data:", (error != ERR_NONE) ? "" : hex2Str( &rxBuf[1], DEMO_NFCV_BLOCK_LEN));
 
-        // IF there was no error reading
-        if (error == 0)
-        {
-            // set Transmit Success Sentinel to TRUE
-            transmitSuccess = 1;
 
-            // reset failure counter to 0
-            failureCounter = 0;
-        }
 
-        // ELSE IF there was an error reading and there have not been 10 consecutive fails
-        else if (failureCounter < MAX_FAILS)
-        {
-            // increment failure counter
-            failureCounter++;
 
-            // Delay for 1 second in case of noise
-            platformDelay(1000);
-        }
+/*********************************************************************************
+* Function Name    : unitIsQuiet
+* Date             : 10/19/2026
+* Description      : Tells whether a unit was programmed since the fixture
+* 					  was last found empty.
+*
+*  Input Parameters: uid, UID of the unit as received in the inventory
+*  Return          : true if the unit needs no more work
+*********************************************************************************/
 
-        // ELSE there are too many failures
-        else
+// BEGIN unitIsQuiet()
+static bool unitIsQuiet( const uint8_t *uid )
+{
+    uint8_t i;
+
+    for (i = 0; i < quietCount; i++)
+    {
+        if (memcmp(quietUIDs[i], uid, RFAL_NFCV_UID_LEN) == 0)
         {
-            // return Write Fail, abort rest of Function
-            return WRITE_FAIL;
+            return true;
         }
-        //END IF
     }
-    // WHILE transmit success sentinel != true AND Failure Counter < 10
-    while ((transmitSuccess != 1) && failureCounter <= MAX_FAILS);
 
-    // FOR each value in the De-Virg Marker
-    for (byteCounter = 0; byteCounter < sizeof(factoryStamp); byteCounter++)
+    return false;
+}
+// END unitIsQuiet()
+
+
+
+
+
+/*********************************************************************************
+* Function Name    : programTarget
+* Date             : 10/19/2026
+* Description      : Programs the unit named by the 'U' command without a
+* 					  discovery cycle. A single slot inventory with the UID
+* 					  as mask confirms the unit in one frame: only a unit
+* 					  matching the mask answers, and when a partial mask
+* 					  matches several units the collision fails the command
+* 					  before anything is written.
+*
+*  Input Parameters: none
+*  Return          : error, WRITE_FAIL if the unit was not found or failed
+*********************************************************************************/
+
+// BEGIN programTarget()
+static uint8_t programTarget( void )
+{
+    rfalNfcvListenDevice target;
+    ReturnCode           err;
+    uint8_t              mask[RFAL_NFCV_UID_LEN];
+    uint8_t              maskLen = MIN(targetUID[0], (RFAL_NFCV_UID_LEN * 8U));
+    uint8_t              bit;
+    uint16_t             rcvLen;
+    uint8_t              error;
+
+    // Sent as printed on the unit, the inventory mask starts with the least significant byte
+    ST_MEMCPY(mask, &targetUID[1], RFAL_NFCV_UID_LEN);
+    REVERSE_BYTES(mask, RFAL_NFCV_UID_LEN);
+    ST_MEMSET(&target, 0, sizeof(target));
+
+    rfalNfcDeactivate(false);
+    err = rfalNfcvPollerInitialize();
+    if (err == ERR_NONE)
     {
-        // IF the read value does not match the expected value
-        if (factoryStamp[byteCounter] != rxBuf[(byteCounter + 1)])
+        err = rfalFieldOnAndStartGT();
+    }
+    if (err == ERR_NONE)
+    {
+        err = rfalNfcvPollerInventory(RFAL_NFCV_NUM_SLOTS_1, maskLen, mask, &target.InvRes, &rcvLen);
+    }
+
+    // The unit answering must match the mask
+    for (bit = 0; (err == ERR_NONE) && (bit < maskLen); bit++)
+    {
+        if (((target.InvRes.UID[bit / 8U] ^ mask[bit / 8U]) & (1U << (bit % 8U))) != 0U)
         {
-            // THEN we are not factory initialized, do not run de-initializer and end loop
-            break;
+            err = ERR_PROTO;
         }
-        // ELSE we have a match
-        else
-        {
-        	// increment match counter
-            matchCounter++;
+    }
 
-        	// IF all values match
-            if (matchCounter == sizeof(factoryStamp))
-        	{
-                // THEN chip is previously initialized, call de-init function to erase it
-                deInitializer(nfcvDev);
-            }
-        }
+    if (err != ERR_NONE)
+    {
+        DEBUG_LOG("Unit %s not found: %d\r\n", hex2Str(&targetUID[1], RFAL_NFCV_UID_LEN), err);
+        traceUart(TRACE_UART_TX, WRITE_FAIL);
+        platformLog("FAIL\n");
+        error = WRITE_FAIL;
+    }
+    else
+    {
+        command = PROGRAM_UID;
+        error   = processCommand(&target);
     }
-    // END FOR
 
-    /********** END Check If Initialized **********/
+    rfalFieldOff();
+    return error;
+}
+// END programTarget()
 
 
 
 
 
+#if UID_HISTORY
+/*********************************************************************************
+* Function Name    : recipeHash
+* Date             : 10/19/2026
+* Description      : Hash of the received program, kept in the unit history
+* 					  to tell a unit holding this recipe from one holding
+* 					  another.
+*
+*  Input Parameters: none
+*  Return          : CRC-CCITT of the program bytes
+*********************************************************************************/
 
-    /********** BEGIN Test Initialization **********/
+// BEGIN recipeHash()
+static uint16_t recipeHash( void )
+{
+    return rfalCrcCalculateCcitt(0xFFFFU, program, PROGRAM_LEN);
+}
+// END recipeHash()
+#endif
 
-    // set first block number to write to Block 60 for the Test Flag
-    blockNum = TEST_FLAG_BLOCK;
 
-    // DO write the test flag into the NFC Chip
-    do
-    {
-        // write Test Flag
-        error = rfalNfcvPollerWriteSingleBlock(reqFlag, uid, blockNum, testFlag, blockLength);
 
-        // log output
-        DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( testFlag, BLOCK_SIZE) );
+
+#if (DEMO_GANG_UNITS > 1U)
+/*********************************************************************************
+* Function Name    : gangProgram
+* Date             : 10/19/2026
+* Description      : Programs every NFC-V unit found by the discovery with the
+* 					  received program. The units are served round robin one
+* 					  step at a time in addressed mode, so the back-off of a
+* 					  failing unit is spent on the others instead of waiting.
+* 					  Sends one line per unit, UID then PASS or FAIL, and a
+* 					  last PASS line if all units passed, FAIL otherwise.
+*
+*  Input Parameters: none
+*  Return          : error, WRITE_FAIL if a unit failed, WRITE_PASS otherwise
+*********************************************************************************/
+
+// BEGIN gangProgram()
+static uint8_t gangProgram( void )
+{
+    rfalNfcDevice *devList;
+    uint8_t       devCnt;
+    uint8_t       units = 0;
+    uint8_t       busy;
+    uint8_t       error = WRITE_PASS;
+    uint8_t       uid[RFAL_NFCV_UID_LEN];
+    uint8_t       i;
+#if UID_HISTORY
+    uint8_t       history;
+#endif
+
+    rfalNfcGetDevicesFound( &devList, &devCnt );
+
+    // Build the job table from the NFC-V units found, units already programmed and left on the fixture are skipped
+    for (i = 0; (i < devCnt) && (units < DEMO_GANG_UNITS); i++)
+    {
+        if ((devList[i].type == RFAL_NFC_LISTEN_TYPE_NFCV) && !unitIsQuiet(devList[i].dev.nfcv.InvRes.UID))
+        {
+            ST_MEMSET(&gangJobs[units], 0, sizeof(GangJob));
+            ST_MEMCPY(gangJobs[units].uid, devList[i].dev.nfcv.InvRes.UID, RFAL_NFCV_UID_LEN);
+            gangJobs[units].state = GANG_JOB_WRITE;
+#if UID_HISTORY
+            // A unit already holding this recipe is only read back
+            history = uidHistoryCheck(gangJobs[units].uid, recipeHash());
+            uidHistoryFlag(gangJobs[units].uid, history);
+            if (history == UID_HISTORY_DONE)
+            {
+                gangJobs[units].state = GANG_JOB_VERIFY;
+                gangJobs[units].known = true;
+            }
+#endif
+            units++;
+        }
+    }
+
+    statsUnitWriteStart();
+
+    // Serve the units round robin until each one passed or failed
+    do
+    {
+        busy = 0;
+        for (i = 0; i < units; i++)
+        {
+            if (gangStep(&gangJobs[i]))
+            {
+                busy++;
+            }
+        }
+    }
+    while (busy != 0U);
+
+    for (i = 0; i < units; i++)
+    {
+#if UID_HISTORY
+        uidHistoryStore(gangJobs[i].uid, recipeHash(), (gangJobs[i].state == GANG_JOB_PASS));
+#endif
+        if (gangJobs[i].state == GANG_JOB_PASS)
+        {
+            unitQuiet(gangJobs[i].uid);
+        }
+    }
+
+    statsUnitWriteDone();
+
+    // Delay to allow UTF to Catch Up
+    platformDelay(1000);
+
+    for (i = 0; i < units; i++)
+    {
+        statsUnitDone(gangJobs[i].state == GANG_JOB_PASS);
+
+        if (gangJobs[i].state != GANG_JOB_PASS)
+        {
+            error = WRITE_FAIL;
+        }
+
+        // UID shown most significant byte first, as on the unit label
+        ST_MEMCPY(uid, gangJobs[i].uid, RFAL_NFCV_UID_LEN);
+        REVERSE_BYTES(uid, RFAL_NFCV_UID_LEN);
+        platformLog("%s %s\n", hex2Str(uid, RFAL_NFCV_UID_LEN), (gangJobs[i].state == GANG_JOB_PASS) ? "PASS" : "FAIL");
+    }
+
+    traceUart(TRACE_UART_TX, error);
+
+    platformLog("%s\n", ((error == WRITE_PASS) && (units != 0U)) ? "PASS" : "FAIL");
+
+    return error;
+}
+// END gangProgram()
+
+
+
+
+
+/*********************************************************************************
+* Function Name    : gangStep
+* Date             : 10/19/2026
+* Description      : Does the next step of one unit: presents the area 1
+* 					  password once, then writes or reads back the recipe.
+* 					  A failed write is retried after GANG_RETRY_MS, at
+* 					  most MAX_FAILS times, a failed read back fails the
+* 					  unit like the single unit flow does.
+*
+*  Input Parameters: job, the unit to serve
+*  Return          : true while the unit is not finished
+*********************************************************************************/
+
+// BEGIN gangStep()
+static bool gangStep( GangJob *job )
+{
+    const uint8_t RF_PWD_1 = 0x01;
+
+    ReturnCode  error;
+    uint8_t     blockRead[PROGRAM_LEN];
+
+    if ((job->state == GANG_JOB_PASS) || (job->state == GANG_JOB_FAIL))
+    {
+        return false;
+    }
+
+    // IF the unit is backing off after a failure
+    if ((job->fails != 0U) && ((int32_t)(platformGetSysTick() - job->retryTick) < 0))
+    {
+        return true;
+    }
+
+    blockIoOpen(job->uid, RFAL_NFCV_REQ_FLAG_DEFAULT, job->uid);
+
+    if (job->state == GANG_JOB_WRITE)
+    {
+        error = ERR_NONE;
+        if (!job->pwdOk)
+        {
+            error = rfalST25xVPollerPresentPassword(RFAL_NFCV_REQ_FLAG_DEFAULT, job->uid, RF_PWD_1, payLoad_RF_AREA_1_PWD, sizeof(payLoad_RF_AREA_1_PWD));
+            job->pwdOk = (error == ERR_NONE);
+        }
+
+        if (error == ERR_NONE)
+        {
+            error = blockIoWrite(RFAL_NFCV_REQ_FLAG_DEFAULT, job->uid, (RECIPE_START_BLOCK + 1U), program, PROGRAM_LEN);
+        }
+        DEBUG_LOG("Unit %s Write Recipe: %s\r\n", hex2Str(job->uid, RFAL_NFCV_UID_LEN), (error != ERR_NONE) ? "FAIL" : "OK");
+
+        if (error == ERR_NONE)
+        {
+            job->fails = 0;
+            job->state = GANG_JOB_VERIFY;
+        }
+        else if (job->fails < MAX_FAILS)
+        {
+            // Present the password again, the unit may have been reset
+            job->fails++;
+            job->pwdOk     = false;
+            job->retryTick = (platformGetSysTick() + GANG_RETRY_MS);
+        }
+        else
+        {
+            job->state = GANG_JOB_FAIL;
+        }
+    }
+    else
+    {
+        error = blockIoRead(RFAL_NFCV_REQ_FLAG_DEFAULT, job->uid, (RECIPE_START_BLOCK + 1U), blockRead, sizeof(blockRead));
+        if (((error != ERR_NONE) || (memcmp(program, blockRead, PROGRAM_LEN) != 0)) && job->known)
+        {
+            // The history was wrong or the unit was reset, it is programmed like a new one
+            job->known = false;
+            job->state = GANG_JOB_WRITE;
+        }
+        else if ((error != ERR_NONE) || (memcmp(program, blockRead, PROGRAM_LEN) != 0))
+        {
+            DEBUG_LOG("Unit %s Verification Failed\r\n", hex2Str(job->uid, RFAL_NFCV_UID_LEN));
+            job->state = GANG_JOB_FAIL;
+        }
+        else
+        {
+            job->state = GANG_JOB_PASS;
+        }
+    }
+
+    return ((job->state != GANG_JOB_PASS) && (job->state != GANG_JOB_FAIL));
+}
+// END gangStep()
+#endif
+
+
+
+
+
+
+
+
+/****************************************************************************
+* Function Name    : initializeTest
+* Date             : 02/10/2023
+* Author           : Paul E. Fritzen
+* Description      : Checks for Virgin State at Block 55 and re-virginizes
+* 						NFC Chip of not virgin. Writes factory initialization
+* 						flag into Block 60.
+*
+*  Input Parameters: nfcvDev, a pointer to an NFC Device Structure
+*  Return          : error, signifies an error occurred if not 0 or no error
+*  					  occurred if 0
+*****************************************************************************/
+
+// BEGIN initializeTest function
+static uint8_t initializeTest( rfalNfcvListenDevice * nfcvDev )
+{
+    //constants
+
+    //variables
+    ReturnCode error;                  // return code for errors. IF 0 then there are no errors
+    uint8_t    blockNum;               // keeps track of the block number to be written to during initialization
+    uint8_t    *uid;                   // Unique Identifier of an NFC tag found within the antenna's field
+    uint8_t    reqFlag;                // Request Flag, used to tell Middleware Functions we are working with an NFC-V Tag
+    uint8_t    blockLength;            // length of a block of data. For the st25dv04k this will always be 4 bytes.
+    uint8_t    byteCounter     = 0;    // counter used to track number of bytes loaded into write/read array
+    uint8_t    matchCounter    = 0;    // counter used to track number of matching bytes read in de-virginized marker
+    uint8_t    failureCounter  = 0;    // counter used to track number of times write/read has failed
+    uint8_t    transmitSuccess = 0;    // sentinel boolean used to gate guard against transmission failure
+
+    uint8_t    blockRead[BLOCK_SIZE];		/* Block Data */
+
+    // placeholder Test Flag File
+    static uint8_t testFlag[BLOCK_SIZE] =
+    {
+        'T', 'E', 'S', 'T'
+    };
+
+    // De-virginized Marker
+    static uint8_t factoryStamp[BLOCK_SIZE] = FACTORY_STAMP;
+
+/**************************************** BEGIN FUNCTION ****************************************/
+
+    // set first block number to read from Block 55 to look for the DV Mark
+    blockNum = STAMP_BLOCK;
+
+    // set UID and flag showing NFC Standard in use is NFC-V/ISO 15693, select mode if the unit is selected
+    unitAddressing(nfcvDev, &reqFlag, &uid);
+    blockIoOpen(nfcvDev->InvRes.UID, reqFlag, uid);
+
+    // set block Length
+    blockLength = BLOCK_SIZE;
+
+    /********** BEGIN Check If Initialized **********/
+
+    // DO
+    do
+    {
+        // read Test Flag Block
+        error = blockIoRead(reqFlag, uid, blockNum, blockRead, sizeof(blockRead));
+
+        // log output
+        DEBUG_LOG(" Read Marker: %s %s\r\n", (error != ERR_NONE) ? "FAIL": "OK Data:", (error != ERR_NONE) ? "" : hex2Str( blockRead, BLOCK_SIZE));
+
+        // IF there was no error reading
+        if (error == 0)
+        {
+            // set Transmit Success Sentinel to TRUE
+            transmitSuccess = 1;
+
+            // reset failure counter to 0
+            failureCounter = 0;
+        }
+
+        // ELSE IF there was an error reading and there have not been 10 consecutive fails
+        else if (failureCounter < MAX_FAILS)
+        {
+            // increment failure counter
+            failureCounter++;
+
+            // Delay for 1 second in case of noise
+            platformDelay(1000);
+        }
+
+        // ELSE there are too many failures
+        else
+        {
+            // return Write Fail, abort rest of Function
+            return WRITE_FAIL;
+        }
+        //END IF
+    }
+    // WHILE transmit success sentinel != true AND Failure Counter < 10
+    while ((transmitSuccess != 1) && failureCounter <= MAX_FAILS);
+
+    // FOR each value in the De-Virg Marker
+    for (byteCounter = 0; byteCounter < sizeof(factoryStamp); byteCounter++)
+    {
+        // IF the read value does not match the expected value
+        if (factoryStamp[byteCounter] != blockRead[byteCounter])
+        {
+            // THEN we are not factory initialized, do not run de-initializer and end loop
+            break;
+        }
+        // ELSE we have a match
+        else
+        {
+        	// increment match counter
+            matchCounter++;
+
+        	// IF all values match
+            if (matchCounter == sizeof(factoryStamp))
+        	{
+                // THEN chip is previously initialized, call de-init function to erase it
+                deInitializer(nfcvDev);
+            }
+        }
+    }
+    // END FOR
+
+    /********** END Check If Initialized **********/
+
+
+
+
+
+
+    /********** BEGIN Test Initialization **********/
+
+    // set first block number to write to Block 60 for the Test Flag
+    blockNum = TEST_FLAG_BLOCK;
+
+    // DO write the test flag into the NFC Chip
+    do
+    {
+        // write Test Flag
+        error = blockIoWrite(reqFlag, uid, blockNum, testFlag, blockLength);
+
+        // log output
+        DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( testFlag, BLOCK_SIZE) );
 
 
         // IF there was no error reading
@@ -841,7 +1556,6 @@ static uint8_t checkReply( rfalNfcvListenDevice * nfcvDev )
     uint8_t    blockNum;                // keeps track of the block number to be written to during initialization
     uint8_t    *uid;                    // Unique Identifier of an NFC tag found within the antenna's field
     uint8_t    reqFlag;                 // Request Flag, used to tell Middleware Functions we are working with an NFC-V Tag
-    uint16_t   rcvLen;					// placeholder variable for receiving Acknowledgment from lower level functions
     uint8_t    byteCounter     = 0;     // counter used to track number of bytes loaded into write/read array
     uint8_t    failureCounter  = 0;     // counter used to track number of times write/read has failed
     uint8_t    transmitSuccess = 0;		// sentinel boolean used to gate guard against transmission failure
@@ -855,26 +1569,24 @@ static uint8_t checkReply( rfalNfcvListenDevice * nfcvDev )
           , 'S'
     };
 
-    uint8_t    rxBuf[ 1 + DEMO_NFCV_BLOCK_LEN + RFAL_CRC_LEN ];		/* Flags + Block Data + CRC */
+    uint8_t    blockRead[BLOCK_SIZE];		/* Block Data */
 
 /**************************************** BEGIN FUNCTION ****************************************/
 
     // set first block number to write to Block 60 for the Test Flag
     blockNum = TEST_REPLY_BLOCK;
 
-    // set UID
-    uid = nfcvDev->InvRes.UID;
-
-    // set flag showing NFC Standard in use is NFC-V/ISO 15693
-    reqFlag = RFAL_NFCV_REQ_FLAG_DEFAULT;
+    // set UID and flag showing NFC Standard in use is NFC-V/ISO 15693, select mode if the unit is selected
+    unitAddressing(nfcvDev, &reqFlag, &uid);
+    blockIoOpen(nfcvDev->InvRes.UID, reqFlag, uid);
 
     // DO
     do
     {
         // read Test Flag Block
-        error = rfalNfcvPollerReadSingleBlock(reqFlag, uid, blockNum, rxBuf, sizeof(rxBuf), &rcvLen);
+        error = blockIoRead(reqFlag, uid, blockNum, blockRead, sizeof(blockRead));
 
-        DEBUG_LOG(" Read Block: %s %s\r\n", (error != ERR_NONE) ? "FAIL": "OK Data:", (error != ERR_NONE) ? "" : hex2Str( &rxBuf[1], DEMO_NFCV_BLOCK_LEN));
+        DEBUG_LOG(" Read Block: %s %s\r\n", (error != ERR_NONE) ? "FAIL": "OK Data:", (error != ERR_NONE) ? "" : hex2Str( blockRead, BLOCK_SIZE));
 
         // IF there was no error reading
         if (error == 0)
@@ -911,7 +1623,7 @@ static uint8_t checkReply( rfalNfcvListenDevice * nfcvDev )
     for (byteCounter = 0; byteCounter < BLOCK_SIZE; byteCounter++)
     {
         // IF the read value does not match the expected value
-        if ( testReply[byteCounter] != rxBuf[(byteCounter + 1)] )
+        if ( testReply[byteCounter] != blockRead[byteCounter] )
         {
             // THEN return Write Fail
             return WRITE_FAIL;
@@ -931,91 +1643,198 @@ static uint8_t checkReply( rfalNfcvListenDevice * nfcvDev )
 // Read it back and store it in 
 static uint8_t writeConfiguration( rfalNfcvListenDevice *nfcvDev )
 {
-    const uint8_t RF_PWD_0 = 0x00;
     const uint8_t RF_PWD_1 = 0x01;
-    const uint8_t RFA1SS   = 0x04;
-    const uint8_t WRT_LOCK = 0x05;
 
     ReturnCode  error;
-    uint8_t     nextBlock;
     uint8_t     *uid;
     uint8_t     reqFlag;
-    uint8_t     blockLength;
-    uint8_t     blockToWrite[BLOCK_SIZE];
-    uint8_t     blockRead[BLOCK_SIZE];
-    uint8_t     byteCounter = 0;
     uint8_t     failureCounter = 0;
-    uint8_t     multiBlockIndex = 0;
-    uint8_t     singleBlockIndex = 0;
-    uint16_t    rcvLen;
 
-    nextBlock = RECIPE_START_BLOCK + 1;
-    uid = nfcvDev->InvRes.UID;
-    reqFlag = RFAL_NFCV_REQ_FLAG_DEFAULT;
-    blockLength = BLOCK_SIZE;
-    nextBlock = RECIPE_START_BLOCK + 1;
+    unitAddressing(nfcvDev, &reqFlag, &uid);
 
-    for (multiBlockIndex = 0; multiBlockIndex < (sizeof(program)); multiBlockIndex++)
+#if MAILBOX_PROGRAM
+    // ICM firmware reading its recipe from the mailbox needs no EEPROM write, its copy of the recipe is read back
+    if ((mailboxProgram(reqFlag, uid, program, sizeof(program)) == ERR_NONE) && (recipeVerify(nfcvDev) == WRITE_PASS))
     {
-        blockToWrite[singleBlockIndex] = program[multiBlockIndex];
-        byteCounter++;
+        DEBUG_LOG("Mailbox Verification Success\r\n");
+        return WRITE_PASS;
+    }
+    unitAddressing(nfcvDev, &reqFlag, &uid);
+#endif
 
-        if (byteCounter == blockLength)
-        {
-            do
-            {
-                error = rfalST25xVPollerPresentPassword(reqFlag, uid, RF_PWD_1, payLoad_RF_AREA_1_PWD, sizeof(payLoad_RF_AREA_1_PWD));
-                DEBUG_LOG("Present Password: %s\r\n", (error != ERR_NONE) ? "FAIL" : "OK");
+    // Memory layout of the unit, asked once per UID, sizes the frames
+    blockIoOpen(nfcvDev->InvRes.UID, reqFlag, uid);
 
-                if (error == 0)
-                {
-                    error = rfalNfcvPollerWriteSingleBlock(reqFlag, uid, nextBlock, blockToWrite, blockLength);
-                    DEBUG_LOG("Write Block %d: %s\r\n", nextBlock, (error != ERR_NONE) ? "FAIL" : "OK");
-                }
+    do
+    {
+        // A unit already protected costs one RFA1SS read, any other one is brought to the factory protection first
+        error = configSync(reqFlag, uid, &configFactory);
 
-                if (error == 0)
-                {
-                    failureCounter = 0;
-                }
-                else if (failureCounter <= MAX_FAILS)
-                {
-                    failureCounter++;
-                    platformDelay(1000);
-                }
-                else
-                {
-                    return WRITE_FAIL;
-                }
-            }
-            while (error != 0 && failureCounter <= MAX_FAILS);
+        if (error == 0)
+        {
+            error = rfalST25xVPollerPresentPassword(reqFlag, uid, RF_PWD_1, payLoad_RF_AREA_1_PWD, sizeof(payLoad_RF_AREA_1_PWD));
+            DEBUG_LOG("Present Password: %s\r\n", (error != ERR_NONE) ? "FAIL" : "OK");
+        }
 
-            byteCounter = 0;
+        if (error == 0)
+        {
+            error = blockIoWrite(reqFlag, uid, (RECIPE_START_BLOCK + 1), program, sizeof(program));
+            DEBUG_LOG("Write Recipe: %s\r\n", (error != ERR_NONE) ? "FAIL" : "OK");
+        }
+
+        if (error == 0)
+        {
             failureCounter = 0;
-            nextBlock++;
         }
+        else if (failureCounter <= MAX_FAILS)
+        {
+            failureCounter++;
+            unitFallback(nfcvDev, &reqFlag, &uid);
+            platformDelay(1000);
+        }
+        else
+        {
+            return WRITE_FAIL;
+        }
+    }
+    while (error != 0 && failureCounter <= MAX_FAILS);
 
-        singleBlockIndex++;
-        if (singleBlockIndex == blockLength)
+    if (error != 0)
+    {
+        return WRITE_FAIL;
+    }
+
+    if (recipeVerify(nfcvDev) != WRITE_PASS)
+    {
+        DEBUG_LOG("Verification Failed\r\n");
+        return WRITE_FAIL;
+    }
+    DEBUG_LOG("Verification Success\r\n");
+
+    return WRITE_PASS;
+}
+
+
+/*********************************************************************************
+* Function Name    : recipeVerify
+* Date             : 10/19/2026
+* Description      : Reads the recipe blocks of the unit back and compares
+* 					  them with the received program. A failed read in
+* 					  select mode is retried once in addressed mode.
+*
+*  Input Parameters: nfcvDev, a pointer to an NFC Device Structure
+*  Return          : WRITE_PASS if the unit holds the program, WRITE_FAIL
+* 					  otherwise
+*********************************************************************************/
+
+// BEGIN recipeVerify()
+static uint8_t recipeVerify( rfalNfcvListenDevice *nfcvDev )
+{
+    ReturnCode  error;
+    uint8_t     *uid;
+    uint8_t     reqFlag;
+    uint8_t     blockRead[PROGRAM_LEN];
+
+    unitAddressing(nfcvDev, &reqFlag, &uid);
+    blockIoOpen(nfcvDev->InvRes.UID, reqFlag, uid);
+
+    error = blockIoRead(reqFlag, uid, (RECIPE_START_BLOCK + 1), blockRead, sizeof(blockRead));
+    if ((error != 0) && nfcvSelected)
+    {
+        unitFallback(nfcvDev, &reqFlag, &uid);
+        error = blockIoRead(reqFlag, uid, (RECIPE_START_BLOCK + 1), blockRead, sizeof(blockRead));
+    }
+
+    return (((error != 0) || (memcmp(program, blockRead, sizeof(program)) != 0)) ? WRITE_FAIL : WRITE_PASS);
+}
+// END recipeVerify()
+
+
+/****************************************************************************
+* Function Name    : configSync
+* Date             : 10/19/2026
+* Description      : Brings the security configuration of the unit to the
+* 					  target with the fewest commands. RFA1SS is read once;
+* 					  a unit already in the target state costs only that
+* 					  read. Otherwise each password still at its old value
+* 					  is changed, then RFA1SS is written and read back to
+* 					  confirm it. A password already
+* 					  changed by an interrupted earlier sync is only
+* 					  presented, so the sync can be retried as a whole.
+*
+*  Input Parameters: reqFlag, request flags, select mode or addressed
+* 					  uid, UID for addressed requests, NULL in select mode
+* 					  target, the configuration to reach
+*  Return          : ERR_NONE, else the error of the command failing
+*
+*****************************************************************************/
+
+// BEGIN configSync function
+static ReturnCode configSync( uint8_t reqFlag, const uint8_t *uid, const ConfigTarget *target )
+{
+    ReturnCode  error;
+    uint8_t     rfa1ss;
+    uint8_t     pwd;
+    bool        cfgOpen = false;    // configuration session open with the target password
+
+    error = rfalST25xVPollerReadConfiguration(reqFlag, uid, CONFIG_RFA1SS, &rfa1ss);
+    if (error != ERR_NONE)
+    {
+        return error;
+    }
+    if (rfa1ss == target->rfa1ss)
+    {
+        DEBUG_LOG("Config Sync: already set\r\n");
+        return ERR_NONE;
+    }
+
+    // Area 1 first, the configuration session is then left for RFA1SS
+    for (pwd = CONFIG_PWD_AREA1 + 1U; pwd-- > CONFIG_PWD_CFG; )
+    {
+        error = rfalST25xVPollerPresentPassword(reqFlag, uid, pwd, target->from[pwd], PWD_SIZE);
+        if (error == ERR_NONE)
         {
-            singleBlockIndex = 0;
+            error = rfalST25xVPollerWritePassword(reqFlag, uid, pwd, target->pwd[pwd], PWD_SIZE);
+            DEBUG_LOG("Config Sync: password %u %s\r\n", pwd, (error != ERR_NONE) ? "FAIL" : "OK");
+        }
+        else
+        {
+            // Changed by an interrupted sync
+            error   = rfalST25xVPollerPresentPassword(reqFlag, uid, pwd, target->pwd[pwd], PWD_SIZE);
+            cfgOpen = (pwd == CONFIG_PWD_CFG);
+        }
+
+        if (error != ERR_NONE)
+        {
+            return error;
         }
     }
 
-    nextBlock = RECIPE_START_BLOCK + 1;
-    for (multiBlockIndex = 0; multiBlockIndex < (sizeof(program)); multiBlockIndex += blockLength)
+    if (!cfgOpen)
     {
-        error = rfalNfcvPollerReadSingleBlock(reqFlag, uid, nextBlock, blockRead, sizeof(blockRead), &rcvLen);
-        if (error != 0 || rcvLen != blockLength || memcmp(&program[multiBlockIndex], blockRead, blockLength) != 0)
+        error = rfalST25xVPollerPresentPassword(reqFlag, uid, CONFIG_PWD_CFG, target->pwd[CONFIG_PWD_CFG], PWD_SIZE);
+        if (error != ERR_NONE)
         {
-            DEBUG_LOG("Verification Failed Block %d\r\n", nextBlock);
-            return WRITE_FAIL;
+            return error;
         }
-        DEBUG_LOG("Verification Success Block %d\r\n", nextBlock);
-        nextBlock++;
     }
 
-    return WRITE_PASS;
+    error = rfalST25xVPollerWriteConfiguration(reqFlag, uid, CONFIG_RFA1SS, target->rfa1ss);
+
+    // The write is only trusted once the register reads back the target
+    if (error == ERR_NONE)
+    {
+        error = rfalST25xVPollerReadConfiguration(reqFlag, uid, CONFIG_RFA1SS, &rfa1ss);
+        if ((error == ERR_NONE) && (rfa1ss != target->rfa1ss))
+        {
+            error = ERR_WRITE;
+        }
+    }
+    DEBUG_LOG("Config Sync: RFA1SS %02X %s\r\n", target->rfa1ss, (error != ERR_NONE) ? "FAIL" : "OK");
+
+    return error;
 }
+// END configSync function
 
 
 /****************************************************************************
@@ -1039,10 +1858,7 @@ static uint8_t writeConfiguration( rfalNfcvListenDevice *nfcvDev )
 static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
 {
     //constants
-    const uint8_t RF_PWD_0 = 0x00;      	// password number designation of RF Configuration Password
     const uint8_t RF_PWD_1 = 0x01;      	// password number designation of RF Area 1 Password
-    const uint8_t RFA1SS   = 0x04;        	// address register of RF Area 1 Password
-    const uint8_t WRT_LOCK = 0x05;      	// bit weight to enable password protected Writes for a user memory area
 
     //variables
     ReturnCode  error;                       // return code for errors. IF 0 then there are no errors
@@ -1181,11 +1997,9 @@ static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
     // set first block number to write to Block 0 for the CC File
     nextBlock = CC_FILE_START;
 
-    // set UID
-    uid = nfcvDev->InvRes.UID;
-
-    // set flag showing NFC Standard in use is NFC-V/ISO 15693
-    reqFlag = RFAL_NFCV_REQ_FLAG_DEFAULT;
+    // set UID and flag showing NFC Standard in use is NFC-V/ISO 15693, select mode if the unit is selected
+    unitAddressing(nfcvDev, &reqFlag, &uid);
+    blockIoOpen(nfcvDev->InvRes.UID, reqFlag, uid);
 
     // set block Length
     blockLength = BLOCK_SIZE;
@@ -1196,7 +2010,7 @@ static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
     do
     {
         // write good CC File
-        error = rfalNfcvPollerWriteSingleBlock(reqFlag, uid, nextBlock, payLoad_GoodCC, blockLength);
+        error = blockIoWrite(reqFlag, uid, nextBlock, payLoad_GoodCC, blockLength);
 
         DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( payLoad_GoodCC, BLOCK_SIZE) );
 
@@ -1263,7 +2077,7 @@ static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
             do
             {
                 // call single block write function sending tx array as parameter
-                error = rfalNfcvPollerWriteSingleBlock(reqFlag, uid, nextBlock, blockToWrite, blockLength);
+                error = blockIoWrite(reqFlag, uid, nextBlock, blockToWrite, blockLength);
 
                 // write results to console
                 DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str(blockToWrite, blockLength));
@@ -1345,7 +2159,7 @@ static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
      do
      {
         // write Product ID
-        error = rfalNfcvPollerWriteSingleBlock(reqFlag, uid, nextBlock, payLoad_ID_INFO, sizeof(payLoad_ID_INFO));
+        error = blockIoWrite(reqFlag, uid, nextBlock, payLoad_ID_INFO, sizeof(payLoad_ID_INFO));
 
         // log output to console
         DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( payLoad_ID_INFO, BLOCK_SIZE) );
@@ -1412,7 +2226,7 @@ static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
             do
             {
                 // call single block write function sending tx array as parameter
-                error = rfalNfcvPollerWriteSingleBlock(reqFlag, uid, nextBlock, blockToWrite, blockLength);
+                error = blockIoWrite(reqFlag, uid, nextBlock, blockToWrite, blockLength);
 
                 // write results to console
                 DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str(blockToWrite, blockLength));
@@ -1478,223 +2292,16 @@ static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
 
     /********** BEGIN Read/Write Permission Configuration **********/
 
-    // DO present RF Configuration password
-     do
-     {
-        // present RF Configuration password to open RF Security Session
-        error = rfalST25xVPollerPresentPassword( reqFlag, uid, RF_PWD_0, payLoad_DEF_PWD, sizeof(payLoad_DEF_PWD) );
-
-        // write results to console
-        DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( payLoad_DEF_PWD, PWD_SIZE) );
-
-        // IF there was no error reading
-        if (error == 0)
-        {
-            // set Transmit Success Sentinel to TRUE
-            transmitSuccess = 1;
-
-            // reset failure counter to 0
-            failureCounter = 0;
-        }
-
-        // ELSE IF there was an error reading and there have not been 10 consecutive fails
-        else if (failureCounter < MAX_FAILS)
-        {
-            // increment failure counter
-            failureCounter++;
-
-            // Delay to allow UTF to Catch Up
-            platformDelay(1000);
-        }
-
-        // ELSE there are too many failures
-        else
-        {
-            // return Write Fail, abort rest of Function
-            return WRITE_FAIL;
-        }
-        // END IF
-
-    }
-    // WHILE transmit success sentinel == false AND Failure Counter < 10
-    while ((transmitSuccess != 1) && failureCounter <= MAX_FAILS);
-
-    // DO change write protections for area 1
-     do
-     {
-
-   	    // change write protection for area 1 so Write is not allowed without presenting a valid password for Area 1
-   	    error = rfalST25xVPollerWriteConfiguration( reqFlag, uid, RFA1SS, WRT_LOCK );
-
-        // write results to console
-        DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", WRT_LOCK );
-
-        // IF there was no error reading
-        if (error == 0)
-        {
-            // set Transmit Success Sentinel to TRUE
-            transmitSuccess = 1;
-
-            // reset failure counter to 0
-            failureCounter = 0;
-        }
-
-        // ELSE IF there was an error reading and there have not been 10 consecutive fails
-        else if (failureCounter < MAX_FAILS)
-        {
-            // increment failure counter
-            failureCounter++;
-
-            // Delay for 1 second in case of noise
-            platformDelay(1000);
-        }
-
-        // ELSE there are too many failures
-        else
-        {
-            // return Write Fail, abort rest of Function
-            return WRITE_FAIL;
-        }
-        // END IF
-
-    }
-    // WHILE transmit success sentinel == false AND Failure Counter < 10
-    while ((transmitSuccess != 1) && failureCounter <= MAX_FAILS);
-
-    // DO
-     do
-     {
-
-        // present RF Configuration password to open RF Security Session
-        error = rfalST25xVPollerPresentPassword( reqFlag, uid, RF_PWD_1, payLoad_DEF_PWD, sizeof(payLoad_DEF_PWD) );
-
-        // write output to console
-        DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( payLoad_DEF_PWD, PWD_SIZE) );
-
-        // IF there was no error reading
-        if (error == 0)
-        {
-            // set Transmit Success Sentinel to TRUE
-            transmitSuccess = 1;
-
-            // reset failure counter to 0
-            failureCounter = 0;
-        }
-
-        // ELSE IF there was an error reading and there have not been 10 consecutive fails
-        else if (failureCounter < MAX_FAILS)
-        {
-            // increment failure counter
-            failureCounter++;
-
-	    // Delay to allow UTF to Catch Up
-            platformDelay(1000);
-        }
-
-        // ELSE there are too many failures
-        else
-        {
-            // return Write Fail, abort rest of Function
-            return WRITE_FAIL;
-        }
-        // END IF
-
-    }
-    // WHILE transmit success sentinel == false AND Failure Counter < 10
-    while ((transmitSuccess != 1) && failureCounter <= MAX_FAILS);
-
-    // DO change password for Memory Area 1
-    do
-    {
-    	// change password for Memory Area 1
-    	error = rfalST25xVPollerWritePassword(reqFlag, uid, RF_PWD_1, payLoad_RF_AREA_1_PWD, sizeof(payLoad_RF_AREA_1_PWD));
-
-    	// log output to console
-        DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str(payLoad_RF_AREA_1_PWD, PWD_SIZE));
-
-        // IF there was no error reading
-        if (error == 0)
-        {
-            // set Transmit Success Sentinel to TRUE
-            transmitSuccess = 1;
-
-            // reset failure counter to 0
-            failureCounter = 0;
-        }
-
-        // ELSE IF there was an error reading and there have not been 10 consecutive fails
-        else if (failureCounter < MAX_FAILS)
-        {
-            // increment failure counter
-            failureCounter++;
-
-	        // Delay for 1 second in case of noise
-            platformDelay(1000);
-        }
-
-        // ELSE there are too many failures
-        else
-        {
-            // return Write Fail, abort rest of Function
-            return WRITE_FAIL;
-        }
-        // END IF
-
-    }
-    // WHILE transmit success sentinel == false AND Failure Counter < 10
-    while ((transmitSuccess != 1) && failureCounter <= MAX_FAILS);
-
-    // DO present RF Configuration password
-    do
-    {
-    	// present RF Configuration password to open RF Security Session
-    	error = rfalST25xVPollerPresentPassword(reqFlag, uid, RF_PWD_0, payLoad_DEF_PWD, sizeof(payLoad_DEF_PWD));
-
-        // log output to console
-        DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str(payLoad_DEF_PWD, PWD_SIZE));
-
-        // IF there was no error reading
-        if (error == 0)
-        {
-            // set Transmit Success Sentinel to TRUE
-            transmitSuccess = 1;
-
-            // reset failure counter to 0
-            failureCounter = 0;
-        }
-
-        // ELSE IF there was an error reading and there have not been 10 consecutive fails
-        else if (failureCounter < MAX_FAILS)
-        {
-            // increment failure counter
-            failureCounter++;
-
-	        // Delay for 1 second in case of noise
-            platformDelay(1000);
-        }
-
-        // ELSE there are too many failures
-        else
-        {
-            // return Write Fail, abort rest of Function
-            return WRITE_FAIL;
-        }
-        // END IF
-
-    }
-    // WHILE transmit success sentinel == false AND Failure Counter < 10
-    while ((transmitSuccess != 1) && failureCounter <= MAX_FAILS);
+    // reset Transmit Success Sentinel, it is still set by the writes above
+    transmitSuccess = 0;
 
-    // DO change password for RF Configuration
+    // DO bring the passwords and the area 1 write protection to their factory state
     do
     {
-    	// change password for RF Configuration
-    	error = rfalST25xVPollerWritePassword( reqFlag, uid, RF_PWD_0, payLoad_RF_CONFIG_PWD, sizeof(payLoad_RF_CONFIG_PWD) );
-
-        // log output to console
-        DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str(payLoad_RF_CONFIG_PWD, PWD_SIZE));
+        // read RFA1SS, change only what is not yet in place
+        error = configSync( reqFlag, uid, &configFactory );
 
-        // IF there was no error reading
+        // IF there was no error
         if (error == 0)
         {
             // set Transmit Success Sentinel to TRUE
@@ -1704,13 +2311,13 @@ static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
             failureCounter = 0;
         }
 
-        // ELSE IF there was an error reading and there have not been 10 consecutive fails
+        // ELSE IF there was an error and there have not been 10 consecutive fails
         else if (failureCounter < MAX_FAILS)
         {
             // increment failure counter
             failureCounter++;
 
-	        // Delay for 1 second in case of noise
+            // Delay for 1 second in case of noise
             platformDelay(1000);
         }
 
@@ -1750,7 +2357,7 @@ static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
     	if (error == 0)
     	{
 			// write De-virginized Marker
-			error = rfalNfcvPollerWriteSingleBlock(reqFlag, uid, nextBlock, payLoad_Factory_Stamp, sizeof(payLoad_ID_INFO));
+			error = blockIoWrite(reqFlag, uid, nextBlock, payLoad_Factory_Stamp, sizeof(payLoad_ID_INFO));
 
 			// log output to console
             DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str(payLoad_Factory_Stamp, BLOCK_SIZE));
@@ -1826,10 +2433,6 @@ static uint8_t factoryInitializer( rfalNfcvListenDevice *nfcvDev )
 static uint8_t deInitializer( rfalNfcvListenDevice *nfcvDev )
 {
     //constants
-    const uint8_t RF_PWD_0   = 0x00;    // password number designation of RF Configuration Password
-    const uint8_t RF_PWD_1   = 0x01;    // password number designation of RF Area 1 Password
-    const uint8_t RFA1SS     = 0x04;    // address register of RF Area 1 Password
-    const uint8_t WRT_UNLOCK = 0x00;    // bit weight to enable password protected Writes for a user memory area
     const uint8_t MEM_FTPRNT = 60;      // size of memory area in blocks that may have been pissed in
 
     //variables
@@ -1850,117 +2453,19 @@ static uint8_t deInitializer( rfalNfcvListenDevice *nfcvDev )
         0x00
     };
 
-    // Default Password
-    static uint8_t payLoad_DEF_PWD[PWD_SIZE] =
-    {
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-    };
-
-    // RF Config Password
-    static uint8_t payLoad_RF_CONFIG_PWD[PWD_SIZE] =
-    {
-        'p',
-        'w',
-        'd',
-        '1',
-        '2',
-        '3',
-        '4',
-        '5'
-    };
-
 /**************************************** BEGIN FUNCTION ****************************************/
 
-    // set UID
-    uid = nfcvDev->InvRes.UID;
-
-    // set flag showing NFC Standard in use is NFC-V/ISO 15693
-    reqFlag = RFAL_NFCV_REQ_FLAG_DEFAULT;
+    // set UID and flag showing NFC Standard in use is NFC-V/ISO 15693, select mode if the unit is selected
+    unitAddressing(nfcvDev, &reqFlag, &uid);
+    blockIoOpen(nfcvDev->InvRes.UID, reqFlag, uid);
 
     // set block Length
     blockLength = BLOCK_SIZE;
 
     /********** BEGIN Read/Write Permission De-Configuration **********/
 
-    // present RF Configuration password to open RF Security Session
-    error = rfalST25xVPollerPresentPassword( reqFlag, uid, RF_PWD_0, payLoad_RF_CONFIG_PWD, sizeof(payLoad_RF_CONFIG_PWD) );
-
-    // write results to console
-    DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( payLoad_DEF_PWD, PWD_SIZE) );
-
-    // IF an error was detected
-    if (error != 0)
-    {
-        // return the WRITE FAIL error code, abort early
-        return WRITE_FAIL;
-    }
-    // END IF
-
-    // change write protection for area 1 back to factory default
-    error = rfalST25xVPollerWriteConfiguration( reqFlag, uid, RFA1SS, WRT_UNLOCK );
-
-    // write results to console
-    DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", WRT_UNLOCK );
-
-    // IF an error was detected
-    if (error != 0)
-    {
-        // return the WRITE FAIL error code, abort early
-        return WRITE_FAIL;
-    }
-    // END IF
-
-    // present RF Configuration password to open RF Security Session
-    error = rfalST25xVPollerPresentPassword( reqFlag, uid, RF_PWD_1, payLoad_RF_CONFIG_PWD, sizeof(payLoad_RF_CONFIG_PWD) );
-
-    // write output to console
-    DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( payLoad_RF_CONFIG_PWD, PWD_SIZE) );
-
-    // IF an error was detected
-    if (error != 0)
-    {
-        // return the WRITE FAIL error code, abort early
-        return WRITE_FAIL;
-    }
-    // END IF
-
-    // change password for Memory Area 1 back to default
-    error = rfalST25xVPollerWritePassword( reqFlag, uid, RF_PWD_1, payLoad_DEF_PWD, sizeof(payLoad_DEF_PWD) );
-
-    // log output to console
-    DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( payLoad_DEF_PWD, PWD_SIZE) );
-
-    // IF an error was detected
-    if (error != 0)
-    {
-        // return the WRITE FAIL error code, abort early
-        return WRITE_FAIL;
-    }
-
-    // present RF Configuration password to open RF Security Session
-    error = rfalST25xVPollerPresentPassword( reqFlag, uid, RF_PWD_0, payLoad_RF_CONFIG_PWD, sizeof(payLoad_RF_CONFIG_PWD) );
-
-    // log output to console
-    DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( payLoad_RF_CONFIG_PWD, PWD_SIZE) );
-
-    // IF an error was detected, abort early
-    if (error != 0)
-    {
-        return WRITE_FAIL;
-    }
-
-    // change password for RF Configuration
-    error = rfalST25xVPollerWritePassword( reqFlag, uid, RF_PWD_0, payLoad_DEF_PWD, sizeof(payLoad_DEF_PWD) );
-
-    // log output to console
-    DEBUG_LOG(" Write Block: %s Data: %s\r\n", (error != ERR_NONE) ? "FAIL": "OK", hex2Str( payLoad_DEF_PWD, PWD_SIZE) );
+    // bring the passwords and the area 1 write protection back to the factory default, read RFA1SS, change only what is not yet in place
+    error = configSync( reqFlag, uid, &configDefault );
 
     // IF an error was detected
     if (error != 0)
@@ -1984,7 +2489,7 @@ static uint8_t deInitializer( rfalNfcvListenDevice *nfcvDev )
         do
         {
             // write good CC File
-            error = rfalNfcvPollerWriteSingleBlock(reqFlag, uid, septicBlock, payLoad_Eraser, blockLength);
+            error = blockIoWrite(reqFlag, uid, septicBlock, payLoad_Eraser, blockLength);
             // IF there was no error reading
             if (error == 0)
             {
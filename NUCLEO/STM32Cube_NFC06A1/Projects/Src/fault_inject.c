@@ -0,0 +1,255 @@
+/*********************************************************************************
+* File Name :	fault_inject.c
+* Description: RF fault injection implementation file
+*		          The trace module calls faultInjectTxRxStart/End around
+*		          every blocking transceive of the RFAL. The real exchange
+*		          always takes place, an injected fault only replaces its
+*		          result, so the air time spent on a failed transceive is
+*		          the one the station really loses.
+*		          Configured with the 'F' UART command followed by
+*		          FAULT_CONFIG_LEN rates, reported with the 'S' command.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "fault_inject.h"
+#include "logger.h"
+#include "utils.h"
+#include "rfal_nfcv.h"
+
+#if DEBUG_OUTPUT
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define FAULT_SEED           0x1C325AU   // fixed seed, the same configuration gives the same fault sequence
+#define FAULT_CMD_POS        1U          // position of the command code in an NFC-V request
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static uint8_t  faultRates[FAULT_CONFIG_LEN];       // configured rates in percent
+static uint32_t faultCount[FAULT_CONFIG_LEN];       // injected faults of each kind
+static uint32_t faultRandom = FAULT_SEED;           // state of the random sequence
+static uint32_t faultRemovedTick;                   // tick at which the removed tag came out of the field
+static bool     faultRemoved;                       // a tag removal is being simulated
+static uint16_t faultTxRxStartUs;                   // start of the current transceive
+static uint32_t faultTxRxCount;                     // transceives seen
+static uint32_t faultTxRxFailed;                    // transceives that did not succeed, injected or real
+static uint32_t faultWastedUs;                      // air time of the transceives that did not succeed
+
+static const char * const faultNames[FAULT_CONFIG_LEN] = { "CRC", "Timeout", "Collision", "Removal", "Pwd NACK" };
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static bool faultRoll( uint8_t kind );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : faultInjectConfigure
+* Date             : 10/19/2026
+* Description      : Sets the fault rates and restarts the fault sequence.
+*
+* Input Parameters : rates, FAULT_CONFIG_LEN rates in percent
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN faultInjectConfigure
+void faultInjectConfigure(const uint8_t *rates)
+{
+	uint8_t i;
+
+	for (i = 0; i < FAULT_CONFIG_LEN; i++)
+	{
+		faultRates[i] = MIN(rates[i], 100U);
+		faultCount[i] = 0;
+	}
+
+	faultRandom      = FAULT_SEED;
+	faultRemoved     = false;
+	faultTxRxCount   = 0;
+	faultTxRxFailed  = 0;
+	faultWastedUs    = 0;
+}
+// END faultInjectConfigure
+
+
+
+
+
+/****************************************************************************
+* Function Name    : faultInjectTxRxStart
+* Date             : 10/19/2026
+* Description      : Marks the start of a blocking transceive.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN faultInjectTxRxStart
+void faultInjectTxRxStart(void)
+{
+	faultTxRxStartUs = platformGetSysTickUs();
+}
+// END faultInjectTxRxStart
+
+
+
+
+
+/****************************************************************************
+* Function Name    : faultInjectTxRxEnd
+* Date             : 10/19/2026
+* Description      : May replace the result of a blocking transceive with an
+* 						injected fault. A removed tag makes every transceive
+* 						time out until FAULT_REMOVAL_MS have passed.
+*
+* Input Parameters : ret, result of the transceive
+* 					 txBuf, transmitted frame (flags, command, ...)
+* 					 txLen, length of txBuf
+*
+* Return		   : ret or the injected fault
+*
+*****************************************************************************/
+
+// BEGIN faultInjectTxRxEnd
+ReturnCode faultInjectTxRxEnd(ReturnCode ret, const uint8_t *txBuf, uint16_t txLen)
+{
+	uint16_t elapsedUs = (uint16_t)(platformGetSysTickUs() - faultTxRxStartUs);
+
+	faultTxRxCount++;
+
+	// IF a removed tag is still out of the field
+	if (faultRemoved && ((platformGetSysTick() - faultRemovedTick) < FAULT_REMOVAL_MS))
+	{
+		ret = ERR_TIMEOUT;
+	}
+	else
+	{
+		faultRemoved = false;
+
+		if (ret == ERR_NONE)
+		{
+			if (faultRoll(FAULT_REMOVAL))
+			{
+				faultRemoved     = true;
+				faultRemovedTick = platformGetSysTick();
+				ret = ERR_TIMEOUT;
+			}
+			else if ( (txLen > FAULT_CMD_POS) && (txBuf[FAULT_CMD_POS] == (uint8_t)RFAL_NFCV_CMD_PRESENT_PASSWORD)
+			       && faultRoll(FAULT_PWD_NACK) )
+			{
+				ret = ERR_PROTO;
+			}
+			else if (faultRoll(FAULT_CRC))
+			{
+				ret = ERR_CRC;
+			}
+			else if (faultRoll(FAULT_TIMEOUT))
+			{
+				ret = ERR_TIMEOUT;
+			}
+			else if (faultRoll(FAULT_COLLISION))
+			{
+				ret = ERR_RF_COLLISION;
+			}
+			else
+			{
+				// No fault injected
+			}
+		}
+	}
+
+	if (ret != ERR_NONE)
+	{
+		faultTxRxFailed++;
+		faultWastedUs += elapsedUs;
+	}
+
+	return ret;
+}
+// END faultInjectTxRxEnd
+
+
+
+
+
+/****************************************************************************
+* Function Name    : faultInjectReport
+* Date             : 10/19/2026
+* Description      : Sends the fault counters and the wasted air time via the
+* 						UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN faultInjectReport
+void faultInjectReport(void)
+{
+	uint8_t i;
+
+	platformLog("RF transceives: %lu, failed %lu, wasted %lu ms\r\n",
+	            (unsigned long)faultTxRxCount, (unsigned long)faultTxRxFailed, (unsigned long)(faultWastedUs / 1000U));
+
+	for (i = 0; i < FAULT_CONFIG_LEN; i++)
+	{
+		platformLog("Fault %s: rate %u%%, injected %lu\r\n", faultNames[i], faultRates[i], (unsigned long)faultCount[i]);
+	}
+}
+// END faultInjectReport
+
+
+
+
+
+/****************************************************************************
+* Function Name    : faultRoll
+* Date             : 10/19/2026
+* Description      : Draws the next number of the xorshift sequence and
+* 						decides if a fault of the given kind is injected.
+*
+* Input Parameters : kind, FAULT_xxx index of the fault
+*
+* Return		   : true if the fault is injected
+*
+*****************************************************************************/
+
+// BEGIN faultRoll
+static bool faultRoll( uint8_t kind )
+{
+	if (faultRates[kind] == 0U)
+	{
+		return false;
+	}
+
+	faultRandom ^= (faultRandom << 13U);
+	faultRandom ^= (faultRandom >> 17U);
+	faultRandom ^= (faultRandom << 5U);
+
+	if ((faultRandom % 100U) < faultRates[kind])
+	{
+		faultCount[kind]++;
+		return true;
+	}
+
+	return false;
+}
+// END faultRoll
+
+#endif /* DEBUG_OUTPUT */
@@ -62,6 +62,10 @@ UART_HandleTypeDef *pLogUsart;      /*!< pointer to the logger Handler */
 // constants
 CommandType command = 0;
 uint8_t program[PROGRAM_LEN]; // Bytes of the configuration that will be written to ICM325A.
+uint8_t targetUID[TARGET_LEN]; // UID mask received with the 'U' command.
+#if DEBUG_OUTPUT
+uint8_t faultConfig[FAULT_CONFIG_LEN]; // Fault rates received with the 'F' command.
+#endif
 
 /* ------------------------- Private Function Prototypes ------------------------- */
 uint8_t logUsartTx(uint8_t *data, uint16_t dataLen);	// initializes the UART handle and UART IP
@@ -294,27 +298,61 @@ void init_UART_RX()
 
 
 /****************************************************************************
-* Function Name    : HAL_UART_RxCpltCallback
-* Date             : unknown
-* Author           : ST-Micro & Paul Fritzen
-* Description      : This function is an Acknowledgment for UART Rx Completion
+* Function Name    : loggerRxByte
+* Date             : 10/19/2026
+* Description      : Parses one byte of the UART command protocol. Sets
+* 						command and g_bMsgReceived once a command is complete.
+* 						Kept apart from the HAL callback so the protocol can
+* 						be fed from any byte source.
 *
-* Input Parameters : huart, UART handle.
+* Input Parameters : read, received byte
 *
 * Return		   : none
 *
 *****************************************************************************/
 
-// BEGIN HAL_UART_RxCpltCallback
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *husart)
+// BEGIN loggerRxByte
+void loggerRxByte(uint8_t read)
 {
 	static int reading_program = 0;
+	static int reading_target = 0;
+	static int targeted = 0;
 	static int bytes_read = 0;
+#if DEBUG_OUTPUT
+	static int reading_fault = 0;
+#endif
 
-	uint8_t read = g_Rx_Data[0];
 
+#if DEBUG_OUTPUT
+	if (reading_fault)
+	{
+		faultConfig[bytes_read] = read;
+		bytes_read++;
 
-	if (!reading_program)
+		if (bytes_read == FAULT_CONFIG_LEN)
+		{
+			// Fault rates have been read
+			g_bMsgReceived = 1;
+			command = FAULT_CONFIG;
+			reading_fault = 0;
+		}
+	}
+	else
+#endif
+	if (reading_target)
+	{
+		targetUID[bytes_read] = read;
+		bytes_read++;
+
+		if (bytes_read == TARGET_LEN)
+		{
+			// UID has been read, the program follows
+			reading_target = 0;
+			reading_program = 1;
+			bytes_read = 0;
+		}
+	}
+	else if (!reading_program)
 	{
 		if (read == '?')
 		{
@@ -327,8 +365,60 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *husart)
 			// Program command
 			// Begin reading bytes of command
 			reading_program = 1;
+			targeted = 0;
+			bytes_read = 0;
+		}
+		else if (read == 'U')
+		{
+			// Program UID command
+			// Begin reading the UID, then the bytes of command
+			reading_target = 1;
+			targeted = 1;
+			bytes_read = 0;
+		}
+		else if (read == 'S')
+		{
+			// Station statistics command
+			g_bMsgReceived = 1;
+			command = STATS;
+		}
+		else if (read == 'D')
+		{
+			// Trace dump command
+			g_bMsgReceived = 1;
+			command = DUMP_TRACE;
+		}
+#if RF_PROBE
+		else if (read == 'R')
+		{
+			// RF transaction counters command
+			g_bMsgReceived = 1;
+			command = RF_COUNTERS;
+		}
+#endif
+#if RAM_PROBE
+		else if (read == 'M')
+		{
+			// RAM use command
+			g_bMsgReceived = 1;
+			command = RAM_REPORT;
+		}
+#endif
+#if DEBUG_OUTPUT
+		else if (read == 'T')
+		{
+			// Codec benchmark command
+			g_bMsgReceived = 1;
+			command = BENCHMARK;
+		}
+		else if (read == 'F')
+		{
+			// Fault injection command
+			// Begin reading the fault rates
+			reading_fault = 1;
 			bytes_read = 0;
 		}
+#endif
 		else
 		{
 			// Ignore other commands
@@ -339,16 +429,38 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *husart)
 		g_bMsgReceived = 1;
 		program[bytes_read] = read;
 		bytes_read++;
-		// Clear buffer so that it's ready for next byte.
-		ST_MEMSET(g_Rx_Data, 0, MAX_RX_SIZE);
 
 		if (bytes_read == PROGRAM_LEN)
 		{
 			// Program has been read. Send it to NFC.
-			command = PROGRAM;
+			command = (targeted ? PROGRAM_UID : PROGRAM);
 			reading_program = 0;
 		}
 	}
+}
+// END loggerRxByte
+
+
+
+
+
+/****************************************************************************
+* Function Name    : HAL_UART_RxCpltCallback
+* Date             : unknown
+* Author           : ST-Micro & Paul Fritzen
+* Description      : This function is an Acknowledgment for UART Rx Completion
+*
+* Input Parameters : huart, UART handle.
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN HAL_UART_RxCpltCallback
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *husart)
+{
+	// call function to parse the received byte
+	loggerRxByte(g_Rx_Data[0]);
 
 	// call function to re-enable UART Rx Interrupts
 	HAL_UART_Receive_IT(pLogUsart, g_Rx_Data, MAX_RX_SIZE);
@@ -0,0 +1,172 @@
+/*********************************************************************************
+* File Name :	mailbox.c
+* Description: Mailbox programming implementation file
+*		          The mailbox is switched on through MB_CTRL_Dyn, the
+*		          message written with Fast Write Message, then MB_CTRL_Dyn
+*		          is read until the ICM took the message: RF_PUT_MSG clears
+*		          once the host read it all, RF_MISS_MSG is set instead
+*		          when the mailbox watchdog gave up on it. The dynamic
+*		          registers are back to their defaults each time the field
+*		          goes off, so nothing is left behind on the unit.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "mailbox.h"
+#include "logger.h"
+#include "rfal_st25xv.h"
+
+#if MAILBOX_PROGRAM
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define MAILBOX_BUF_LEN      (MAILBOX_MSG_MAX + 16U)    // flags, command, IC code, UID, length and CRC around the message
+
+#define MB_CTRL_DYN          0x0DU  // dynamic register pointer of MB_CTRL_Dyn
+#define MB_EN                0x01U  // mailbox on
+#define HOST_PUT_MSG         0x02U  // message put by the host, not read by RF yet
+#define RF_PUT_MSG           0x04U  // message put by RF, not read by the host yet
+#define RF_MISS_MSG          0x20U  // message put by RF released unread by the watchdog
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static uint8_t mailboxBuf[MAILBOX_BUF_LEN];		// Fast Write Message request
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static ReturnCode mailboxOpen( uint8_t reqFlag, const uint8_t *uid );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : mailboxProgram
+* Date             : 10/19/2026
+* Description      : Puts the message into the mailbox of the unit and reads
+* 						MB_CTRL_Dyn until the ICM read it or MAILBOX_DONE_MS
+* 						passed. A message not read in time is taken back by
+* 						switching the mailbox off.
+*
+* Input Parameters : reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+* 					 msg, message to send
+* 					 len, bytes of the message, 1 to MAILBOX_MSG_MAX
+*
+* Return		   : ERR_NONE once the ICM read the message, ERR_TIMEOUT if
+* 					 it did not in time, else the error of the RFAL
+* 					 command failing
+*
+*****************************************************************************/
+
+// BEGIN mailboxProgram
+ReturnCode mailboxProgram(uint8_t reqFlag, const uint8_t *uid, const uint8_t *msg, uint16_t len)
+{
+	ReturnCode error;
+	uint32_t   start;
+	uint8_t    ctrl;
+
+	if ((len == 0U) || (len > MAILBOX_MSG_MAX))
+	{
+		return ERR_PARAM;
+	}
+
+	error = mailboxOpen(reqFlag, uid);
+	if (error != ERR_NONE)
+	{
+		DEBUG_LOG("Mailbox: not available\r\n");
+		return error;
+	}
+
+	// The length goes on air as is, 0 for one byte
+	error = rfalST25xVPollerFastWriteMessage(reqFlag, uid, (uint8_t)(len - 1U), msg, mailboxBuf, sizeof(mailboxBuf));
+	if (error != ERR_NONE)
+	{
+		return error;
+	}
+
+	start = platformGetSysTick();
+	do
+	{
+		error = rfalST25xVPollerFastReadDynamicConfiguration(reqFlag, uid, MB_CTRL_DYN, &ctrl);
+		if (error == ERR_NONE)
+		{
+			if ((ctrl & RF_MISS_MSG) != 0U)
+			{
+				break;
+			}
+			if ((ctrl & RF_PUT_MSG) == 0U)
+			{
+				DEBUG_LOG("Mailbox: read by the ICM after %lu ms\r\n", (unsigned long)(platformGetSysTick() - start));
+				return ERR_NONE;
+			}
+		}
+	}
+	while ((platformGetSysTick() - start) < MAILBOX_DONE_MS);
+
+	DEBUG_LOG("Mailbox: not read by the ICM\r\n");
+	rfalST25xVPollerFastWriteDynamicConfiguration(reqFlag, uid, MB_CTRL_DYN, 0U);
+
+	return ERR_TIMEOUT;
+}
+// END mailboxProgram
+
+
+
+
+
+/****************************************************************************
+* Function Name    : mailboxOpen
+* Date             : 10/19/2026
+* Description      : Makes the mailbox of the unit ready for a message from
+* 						RF. A mailbox still holding a message is emptied by
+* 						switching it off and on again.
+*
+* Input Parameters : reqFlag, request flags, select mode or addressed
+* 					 uid, UID for addressed requests, NULL in select mode
+*
+* Return		   : ERR_NONE, else the error of the RFAL command failing,
+* 					 which is how a unit without MB_MODE refuses the
+* 					 mailbox
+*
+*****************************************************************************/
+
+// BEGIN mailboxOpen
+static ReturnCode mailboxOpen( uint8_t reqFlag, const uint8_t *uid )
+{
+	ReturnCode error;
+	uint8_t    ctrl;
+
+	error = rfalST25xVPollerFastReadDynamicConfiguration(reqFlag, uid, MB_CTRL_DYN, &ctrl);
+	if (error != ERR_NONE)
+	{
+		return error;
+	}
+
+	if (((ctrl & MB_EN) != 0U) && ((ctrl & (HOST_PUT_MSG | RF_PUT_MSG)) == 0U))
+	{
+		return ERR_NONE;
+	}
+
+	if ((ctrl & MB_EN) != 0U)
+	{
+		error = rfalST25xVPollerFastWriteDynamicConfiguration(reqFlag, uid, MB_CTRL_DYN, 0U);
+		if (error != ERR_NONE)
+		{
+			return error;
+		}
+	}
+
+	return rfalST25xVPollerFastWriteDynamicConfiguration(reqFlag, uid, MB_CTRL_DYN, MB_EN);
+}
+// END mailboxOpen
+
+#endif /* MAILBOX_PROGRAM */
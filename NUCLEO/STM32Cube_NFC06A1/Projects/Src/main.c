@@ -50,6 +50,8 @@
 #include "demo.h"
 #include "platform.h"
 #include "logger.h"
+#include "boot.h"
+#include "ram_probe.h"
 #include "st_errno.h"
 #include "rfal_rf.h"
 #include "rfal_analogConfig.h"
@@ -89,6 +91,11 @@ void SystemClock_Config(void);		// prototype to init system clock
 // BEGIN main
 int main(void)
 {
+#if RAM_PROBE
+	// Call Function to paint the free stack for the high-water marks
+	ramProbeInit();
+#endif
+
     // Call Function to Initialize Hardware Abstraction Layer (HAL)
 	HAL_Init();	/* STM32L0xx HAL library initialization:
        	   	   	   - Configure the Flash pre-fetch, Flash pre-read and Buffer caches
@@ -101,6 +108,7 @@ int main(void)
 
 	// Call Function to Configure System Clock
 	SystemClock_Config();		/* Configure the System clock to have a frequency of 80 MHz */
+	bootMark("clock");
 
 	// Call Function to initialize ADC
 //  MX_ADC_Init(); // zzqq re-pin, Delete this if not using ADC for testing Super Cap
@@ -126,11 +134,16 @@ int main(void)
 //END IF RFAL_USE_I2C
 #endif
 
+	// Call Function to start the microsecond time base used for RF guard times
+	BSP_TimeBaseUs_Init();
+	bootMark("bus");
+
 	// Call Function to initialize log module
 	logUsartInit(&hlogger);
   
     // Call Function to initialize UART RX
     init_UART_RX();
+	bootMark("uart");
 
    // display boot up msg in debug mode
     DEBUG_LOG("NFC Reader/Writer for ICM using Nucleo-L053R8 & X-NUCLEO-NFC06A1\r\n");
@@ -159,7 +172,12 @@ int main(void)
   else
   {
     DEBUG_LOG("Initialization succeeded..\r\n");
+	bootMark("rfal");
 
+// IF fast boot, the LED self-test runs along with the tag finder
+#if BOOT_FAST
+	bootLedStart();
+#else
 	// Toggle each LED 6x
 	for (int i = 0; i < 6; i++)
 	{
@@ -180,11 +198,19 @@ int main(void)
 	NFC06A1_LED_OFF( TV_LED );
 	NFC06A1_LED_OFF( AP2P_LED );
 	NFC06A1_LED_OFF( TX_LED );
+#endif
   }
 
+  bootMark("ready");
+
   /* WHILE Forever */
   while (1)
   {
+#if BOOT_FAST
+	// Call Function to step the LED self-test
+	bootLedTask();
+#endif
+
 	/* Run Tag Finder Application */
 	hariKari = tagFinder();
 
@@ -225,6 +225,36 @@ int32_t BSP_GetTick(void)
   return HAL_GetTick();
 }
 
+/**
+  * @brief  Start TIM2 as a free running 1 MHz counter, time base of the us timers
+  * @note   TIM2 is 16 bit on STM32L0 so the count wraps every 65.536 ms.
+  *         APB1 is not divided, so TIM2 runs from HCLK.
+  * @param  None
+  * @return BSP status
+  */
+int32_t BSP_TimeBaseUs_Init(void)
+{
+  __HAL_RCC_TIM2_CLK_ENABLE();
+
+  TIM2->CR1 = 0U;
+  TIM2->PSC = (uint16_t)((SystemCoreClock / 1000000U) - 1U);
+  TIM2->ARR = 0xFFFFU;
+  TIM2->EGR = TIM_EGR_UG;   /* Load the prescaler */
+  TIM2->CR1 = TIM_CR1_CEN;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Return the 16 bit microsecond time base
+  * @param  None
+  * @return Current TIM2 count in us
+  */
+uint16_t BSP_GetTickUs(void)
+{
+  return (uint16_t)TIM2->CNT;
+}
+
 #ifndef RFAL_USE_I2C
 /* BUS IO driver over SPI Peripheral */
 /*******************************************************************************
@@ -357,17 +387,36 @@ int32_t BSP_SPI1_Recv(uint8_t * const pData, const uint16_t Length)
   */
 int32_t BSP_SPI1_SendRecv(const uint8_t * const pTxData, uint8_t * const pRxData, uint16_t Length)
 {
-  HAL_StatusTypeDef status;
-  uint8_t   tx[256];
-  uint8_t   rx[256];
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t   dummy[16];
+  uint16_t  len;
+  uint16_t  i;
   int32_t ret = BSP_ERROR_NONE;
   
-  if (pTxData != NULL)
+  /* Buffers are handed to the HAL as they are: no copy, and no length limit (FIFO loads can be up to 512 bytes) */
+  if ((pTxData != NULL) && (pRxData != NULL))
   {
-    (void)memcpy(tx, pTxData, Length);
+    status = HAL_SPI_TransmitReceive(&Handle_Spi1, (uint8_t *)pTxData, pRxData, Length, BUS_SPI1_TIMEOUT);
+  }
+  else if (pTxData != NULL)
+  {
+    status = HAL_SPI_Transmit(&Handle_Spi1, (uint8_t *)pTxData, Length, BUS_SPI1_TIMEOUT);
+  }
+  else if (pRxData != NULL)
+  {
+    /* Full duplex master: the content of pRxData is clocked out while receiving */
+    status = HAL_SPI_Receive(&Handle_Spi1, pRxData, Length, BUS_SPI1_TIMEOUT);
+  }
+  else
+  {
+    /* Received data is discarded */
+    for (i = 0; (i < Length) && (status == HAL_OK); i += len)
+    {
+      len = (uint16_t)(((Length - i) < sizeof(dummy)) ? (Length - i) : sizeof(dummy));
+      (void)memset(dummy, 0, len);
+      status = HAL_SPI_Receive(&Handle_Spi1, dummy, len, BUS_SPI1_TIMEOUT);
+    }
   }
-  
-  status = HAL_SPI_TransmitReceive(&Handle_Spi1, tx, (pRxData != NULL) ? (uint8_t *)pRxData : rx, Length, BUS_SPI1_TIMEOUT);
 
   /* Check the communication status */
   if (status != HAL_OK)
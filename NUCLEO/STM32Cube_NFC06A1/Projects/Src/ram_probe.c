@@ -0,0 +1,302 @@
+/*********************************************************************************
+* File Name :	ram_probe.c
+* Description: RAM budget probe implementation file
+*		          The stack grows down from _estack towards the heap
+*		          reserve of the linker script. Everything between the
+*		          heap reserve and the stack pointer is painted with a
+*		          pattern; the lowest word no longer holding it is the
+*		          deepest point the stack reached. Interrupts are masked
+*		          while painting so no exception frame is overwritten,
+*		          and their stack use counts towards the path they
+*		          interrupted.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "ram_probe.h"
+#include "logger.h"
+#include "utils.h"
+
+#if RAM_PROBE
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define RAM_PAINT            0xC5C5C5C5UL   // pattern of the unused stack
+#define RAM_PAINT_MARGIN     8U             // words below the stack pointer left alone
+
+
+
+
+
+/* ------------------------- Private Types ------------------------- */
+typedef struct
+{
+	const char *name;			// name of the module group
+	const uint8_t *start;		// first bss byte of the group
+	const uint8_t *end;			// first byte after the group
+} RamModule;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+// Symbols of the linker script, only their addresses are meaningful
+extern uint8_t _estack;
+extern uint8_t _end;
+extern uint8_t _sdata;
+extern uint8_t _edata;
+extern uint8_t _sbss;
+extern uint8_t _ebss;
+extern uint8_t _sbss_rfal;
+extern uint8_t _ebss_rfal;
+extern uint8_t _sbss_demo;
+extern uint8_t _ebss_demo;
+extern uint8_t _sbss_logger;
+extern uint8_t _ebss_logger;
+extern uint8_t _sbss_probe;
+extern uint8_t _ebss_probe;
+extern uint8_t _Min_Heap_Size;
+extern uint8_t _Min_Stack_Size;
+extern uint8_t _Static_Ram_Budget;
+
+extern char *_sbrk(int incr);
+
+static uint32_t ramPathMax[RAM_PATHS];			// deepest stack use of each call path in bytes
+static uint32_t ramStackMax;					// deepest stack use since reset in bytes
+
+static const char * const ramPathNames[RAM_PATHS] = { "Discovery", "Command", "Program" };
+
+static const RamModule ramModules[] =
+{
+	{ "RFAL",   &_sbss_rfal,   &_ebss_rfal   },
+	{ "Demo",   &_sbss_demo,   &_ebss_demo   },
+	{ "Logger", &_sbss_logger, &_ebss_logger },
+	{ "Probes", &_sbss_probe,  &_ebss_probe  },
+};
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static uint32_t *ramStackBottom( void );
+static void      ramPaint( void );
+static uint32_t  ramStackDepth( void );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : ramProbeInit
+* Date             : 10/19/2026
+* Description      : Paints the whole free stack. Called first thing in main.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN ramProbeInit
+void ramProbeInit(void)
+{
+	ramPaint();
+}
+// END ramProbeInit
+
+
+
+
+
+/****************************************************************************
+* Function Name    : ramProbePathStart
+* Date             : 10/19/2026
+* Description      : Paints the stack below the caller, right before a
+* 						call path is entered.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN ramProbePathStart
+void ramProbePathStart(void)
+{
+	ramPaint();
+}
+// END ramProbePathStart
+
+
+
+
+
+/****************************************************************************
+* Function Name    : ramProbePathEnd
+* Date             : 10/19/2026
+* Description      : Finds the deepest stack use since ramProbePathStart and
+* 						keeps it as high-water mark of the call path.
+*
+* Input Parameters : path, RAM_PATH_xxx call path that just returned
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN ramProbePathEnd
+void ramProbePathEnd(uint8_t path)
+{
+	uint32_t depth = ramStackDepth();
+
+	ramPathMax[path] = MAX(ramPathMax[path], depth);
+	ramStackMax      = MAX(ramStackMax, depth);
+}
+// END ramProbePathEnd
+
+
+
+
+
+/****************************************************************************
+* Function Name    : ramProbeReport
+* Date             : 10/19/2026
+* Description      : Sends the stack, heap and static RAM use via the UART
+* 						interface: stack high-water mark in total and per call
+* 						path, heap taken through _sbrk and bss per module
+* 						group. The high-water marks are kept.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN ramProbeReport
+void ramProbeReport(void)
+{
+	uint32_t stackSize = (uint32_t)(&_estack - (const uint8_t *)ramStackBottom());
+	uint32_t bss       = (uint32_t)(&_ebss - &_sbss);
+	uint32_t other     = bss;
+	uint32_t size;
+	uint8_t  i;
+
+	ramStackMax = MAX(ramStackMax, ramStackDepth());
+
+	platformLog("Stack: size %lu, reserved %lu, high-water %lu, free %lu\r\n", (unsigned long)stackSize,
+	            (unsigned long)(uint32_t)&_Min_Stack_Size, (unsigned long)ramStackMax, (unsigned long)(stackSize - ramStackMax));
+
+	platformLog("path,highWater\r\n");
+	for (i = 0; i < RAM_PATHS; i++)
+	{
+		platformLog("%s,%lu\r\n", ramPathNames[i], (unsigned long)ramPathMax[i]);
+	}
+
+	platformLog("Heap: reserved %lu, used %lu\r\n", (unsigned long)(uint32_t)&_Min_Heap_Size,
+	            (unsigned long)(uint32_t)((uint8_t *)_sbrk(0) - &_end));
+
+	platformLog("Static: data %lu, bss %lu, budget %lu\r\n", (unsigned long)(uint32_t)(&_edata - &_sdata),
+	            (unsigned long)bss, (unsigned long)(uint32_t)&_Static_Ram_Budget);
+
+	platformLog("module,bss\r\n");
+	for (i = 0; i < (sizeof(ramModules) / sizeof(ramModules[0])); i++)
+	{
+		size     = (uint32_t)(ramModules[i].end - ramModules[i].start);
+		other   -= size;
+		platformLog("%s,%lu\r\n", ramModules[i].name, (unsigned long)size);
+	}
+	platformLog("Other,%lu\r\n", (unsigned long)other);
+}
+// END ramProbeReport
+
+
+
+
+
+/****************************************************************************
+* Function Name    : ramStackBottom
+* Date             : 10/19/2026
+* Description      : Lowest address the stack may use, right above the heap
+* 						reserve of the linker script.
+*
+* Input Parameters : none
+*
+* Return		   : first word of the stack area
+*
+*****************************************************************************/
+
+// BEGIN ramStackBottom
+static uint32_t *ramStackBottom( void )
+{
+	return (uint32_t *)(((uint32_t)&_end + (uint32_t)&_Min_Heap_Size + 3U) & ~3U);
+}
+// END ramStackBottom
+
+
+
+
+
+/****************************************************************************
+* Function Name    : ramPaint
+* Date             : 10/19/2026
+* Description      : Paints the stack from its bottom up to RAM_PAINT_MARGIN
+* 						words below the stack pointer, interrupts masked.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN ramPaint
+static void ramPaint( void )
+{
+	uint32_t  pm = __get_PRIMASK();
+	uint32_t *p  = ramStackBottom();
+	uint32_t *top;
+
+	__disable_irq();
+
+	top = ((uint32_t *)__get_MSP() - RAM_PAINT_MARGIN);
+	while (p < top)
+	{
+		*p++ = RAM_PAINT;
+	}
+
+	__set_PRIMASK(pm);
+}
+// END ramPaint
+
+
+
+
+
+/****************************************************************************
+* Function Name    : ramStackDepth
+* Date             : 10/19/2026
+* Description      : Looks for the lowest stack word that lost the pattern.
+*
+* Input Parameters : none
+*
+* Return		   : deepest stack use since the last paint in bytes
+*
+*****************************************************************************/
+
+// BEGIN ramStackDepth
+static uint32_t ramStackDepth( void )
+{
+	const uint32_t *p = ramStackBottom();
+
+	while ((p < (const uint32_t *)&_estack) && (*p == RAM_PAINT))
+	{
+		p++;
+	}
+
+	return (uint32_t)(&_estack - (const uint8_t *)p);
+}
+// END ramStackDepth
+
+#endif /* RAM_PROBE */
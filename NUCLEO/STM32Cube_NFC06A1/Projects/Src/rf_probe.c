@@ -0,0 +1,271 @@
+/*********************************************************************************
+* File Name :	rf_probe.c
+* Description: RF transaction probe implementation file
+*		          One slot per NFC-V command code, taken in the order the
+*		          codes are first seen. Transceives of further codes once
+*		          all slots are in use are only counted as dropped. Slots
+*		          are only written from the main loop, so no locking is
+*		          needed.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "rf_probe.h"
+#include "logger.h"
+#include "utils.h"
+#include "st25r3916_irq.h"
+#include "st25r3916_com.h"
+
+#if RF_PROBE
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define RF_PROBE_ERR_TIMEOUT     0U     // error histogram buckets
+#define RF_PROBE_ERR_CRC         1U
+#define RF_PROBE_ERR_COLLISION   2U
+#define RF_PROBE_ERR_FRAMING     3U
+#define RF_PROBE_ERR_PROTO       4U     // includes error responses of the tag
+#define RF_PROBE_ERR_OTHER       5U
+#define RF_PROBE_ERR_BUCKETS     6U
+
+
+
+
+
+/* ------------------------- Private Types ------------------------- */
+typedef struct
+{
+	uint32_t count;								// transceives
+	uint32_t txBytes;							// bytes sent, CRC excluded
+	uint32_t rxBytes;							// bytes received, CRC excluded
+	uint32_t totalUs;							// summed duration
+	uint16_t maxUs;								// longest duration
+	uint16_t errors[RF_PROBE_ERR_BUCKETS];		// failed transceives by error code
+	uint8_t  cmd;								// NFC-V command code
+} RfProbeSlot;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static RfProbeSlot rfProbeSlots[RF_PROBE_CMDS];	// counters per command code
+static uint8_t     rfProbeUsed;					// slots in use
+static uint32_t    rfProbeDropped;				// transceives not counted, all slots in use
+
+#ifdef ST25R_COM_PROFILE
+static const char * const rfProbePhaseNames[ST25R3916_COM_PHASE_NUM] = { "Other", "Discovery", "SetMode", "Transceive", "AnalogCfg", "IRQ" };
+static const char * const rfProbeOpNames[ST25R3916_COM_OP_NUM]       = { "Reg", "FIFO", "PTMem", "Cmd" };
+#endif
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static uint8_t rfProbeErrBucket( ReturnCode ret );
+#ifdef ST25R_COM_PROFILE
+static void    rfProbeSpiReport( void );
+#endif
+
+
+
+
+
+/****************************************************************************
+* Function Name    : rfProbeRecord
+* Date             : 10/19/2026
+* Description      : Counts one blocking RF transceive.
+*
+* Input Parameters : cmd, NFC-V command code
+* 					 txLen, bytes sent
+* 					 rxLen, bytes received
+* 					 ret, result of the transceive
+* 					 durUs, duration in us
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN rfProbeRecord
+void rfProbeRecord(uint8_t cmd, uint16_t txLen, uint16_t rxLen, ReturnCode ret, uint16_t durUs)
+{
+	RfProbeSlot *p;
+	uint8_t      i;
+	uint8_t      b;
+
+	for (i = 0; i < rfProbeUsed; i++)
+	{
+		if (rfProbeSlots[i].cmd == cmd)
+		{
+			break;
+		}
+	}
+
+	if (i == rfProbeUsed)
+	{
+		if (rfProbeUsed >= RF_PROBE_CMDS)
+		{
+			rfProbeDropped++;
+			return;
+		}
+		rfProbeSlots[i].cmd = cmd;
+		rfProbeUsed++;
+	}
+
+	p = &rfProbeSlots[i];
+	p->count++;
+	p->txBytes += txLen;
+	p->rxBytes += rxLen;
+	p->totalUs += durUs;
+	p->maxUs    = MAX(p->maxUs, durUs);
+
+	if (ret != ERR_NONE)
+	{
+		b = rfProbeErrBucket(ret);
+		if (p->errors[b] < UINT16_MAX)
+		{
+			p->errors[b]++;
+		}
+	}
+}
+// END rfProbeRecord
+
+
+
+
+
+/****************************************************************************
+* Function Name    : rfProbeReport
+* Date             : 10/19/2026
+* Description      : Sends the counters via the UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN rfProbeReport
+void rfProbeReport(void)
+{
+	const RfProbeSlot *p;
+	uint8_t  i;
+	uint32_t wakeLast;
+	uint32_t wakeMax;
+
+	platformLog("cmd,count,txBytes,rxBytes,totalUs,avgUs,maxUs,timeout,crc,collision,framing,proto,other\r\n");
+
+	for (i = 0; i < rfProbeUsed; i++)
+	{
+		p = &rfProbeSlots[i];
+
+		platformLog("%02X,%lu,%lu,%lu,%lu,%lu,%u,%u,%u,%u,%u,%u,%u\r\n", p->cmd, (unsigned long)p->count,
+		            (unsigned long)p->txBytes, (unsigned long)p->rxBytes, (unsigned long)p->totalUs,
+		            (unsigned long)(p->totalUs / p->count), p->maxUs,
+		            p->errors[RF_PROBE_ERR_TIMEOUT], p->errors[RF_PROBE_ERR_CRC], p->errors[RF_PROBE_ERR_COLLISION],
+		            p->errors[RF_PROBE_ERR_FRAMING], p->errors[RF_PROBE_ERR_PROTO], p->errors[RF_PROBE_ERR_OTHER]);
+	}
+
+	if (rfProbeDropped != 0U)
+	{
+		platformLog("Dropped: %lu\r\n", (unsigned long)rfProbeDropped);
+	}
+
+	// Interrupt to waiter latency, the worst case restarts with this report
+	st25r3916GetWakeLatency(&wakeLast, &wakeMax);
+	platformLog("IRQ wake cycles: last %lu, max %lu\r\n", (unsigned long)wakeLast, (unsigned long)wakeMax);
+
+#ifdef ST25R_COM_PROFILE
+	rfProbeSpiReport();
+#endif
+}
+// END rfProbeReport
+
+
+
+
+
+#ifdef ST25R_COM_PROFILE
+/****************************************************************************
+* Function Name    : rfProbeSpiReport
+* Date             : 10/19/2026
+* Description      : Sends the ST25R3916 SPI traffic via the UART interface,
+* 						one line per phase and operation kind that saw any.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN rfProbeSpiReport
+static void rfProbeSpiReport( void )
+{
+	const st25r3916ComProfile *p;
+	uint8_t phase;
+	uint8_t op;
+
+	platformLog("phase,op,csCycles,bytes,busUs\r\n");
+
+	for (phase = 0; phase < ST25R3916_COM_PHASE_NUM; phase++)
+	{
+		for (op = 0; op < ST25R3916_COM_OP_NUM; op++)
+		{
+			p = st25r3916comGetProfile(phase, op);
+			if (p->csCycles != 0U)
+			{
+				platformLog("%s,%s,%lu,%lu,%lu\r\n", rfProbePhaseNames[phase], rfProbeOpNames[op],
+				            (unsigned long)p->csCycles, (unsigned long)p->bytes, (unsigned long)p->us);
+			}
+		}
+	}
+}
+// END rfProbeSpiReport
+#endif
+
+
+
+
+
+/****************************************************************************
+* Function Name    : rfProbeErrBucket
+* Date             : 10/19/2026
+* Description      : Maps a result code to its error histogram bucket.
+*
+* Input Parameters : ret, failed result of a transceive
+*
+* Return		   : RF_PROBE_ERR_xxx bucket
+*
+*****************************************************************************/
+
+// BEGIN rfProbeErrBucket
+static uint8_t rfProbeErrBucket( ReturnCode ret )
+{
+	switch (ret)
+	{
+		case ERR_TIMEOUT:
+			return RF_PROBE_ERR_TIMEOUT;
+
+		case ERR_CRC:
+			return RF_PROBE_ERR_CRC;
+
+		case ERR_RF_COLLISION:
+			return RF_PROBE_ERR_COLLISION;
+
+		case ERR_FRAMING:
+		case ERR_INCOMPLETE_BYTE:
+			return RF_PROBE_ERR_FRAMING;
+
+		case ERR_PROTO:
+			return RF_PROBE_ERR_PROTO;
+
+		default:
+			return RF_PROBE_ERR_OTHER;
+	}
+}
+// END rfProbeErrBucket
+
+#endif /* RF_PROBE */
@@ -0,0 +1,335 @@
+/*********************************************************************************
+* File Name :	stats.c
+* Description: Station statistics implementation file
+*		          Each unit goes through a cycle: the UI sends the program
+*		          (armed), the tag is found and written (write), and the
+*		          result is reported (done). The write and the whole cycle
+*		          are timed separately, so the share of the cycle spent on RF
+*		          can be told apart from tag detection and fixed delays. The
+*		          projected units per hour assume back to back cycles, the
+*		          observed figure uses the time between the first and the
+*		          latest result and includes operator handling.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "stats.h"
+#include "logger.h"
+#include "utils.h"
+#include "fault_inject.h"
+#include "boot.h"
+#include "uid_history.h"
+#include <string.h>
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define STATS_HIST_BUCKETS   40U    // buckets of the cycle time histogram
+#define STATS_HIST_MS        200U   // width of a bucket, the last one also holds longer cycles
+#define STATS_PERCENTILE     99U    // percentile of the cycle time reported
+
+
+
+
+
+/* ------------------------- Private Types ------------------------- */
+typedef struct
+{
+	uint32_t count;		// number of samples
+	uint32_t sum;		// sum of all samples in ms
+	uint32_t min;		// shortest sample in ms
+	uint32_t max;		// longest sample in ms
+} StatsTime;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static StatsTime statsWrite;			// RF programming time of each unit
+static StatsTime statsCycle;			// program command to result time of each unit
+static uint32_t  statsPass;				// units programmed successfully
+static uint32_t  statsFail;				// units that failed
+static uint32_t  statsArmedTick;		// tick of the latest program command
+static uint32_t  statsWriteTick;		// tick of the latest write start
+static uint32_t  statsFirstDoneTick;	// tick of the first result
+static uint32_t  statsLastDoneTick;		// tick of the latest result
+static bool      statsArmed;			// a cycle is in progress
+static uint16_t  statsCycleHist[STATS_HIST_BUCKETS];	// histogram of the cycle times
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static void statsAdd( StatsTime *t, uint32_t ms );
+static void statsPrint( const char *name, const StatsTime *t );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : statsUnitArmed
+* Date             : 10/19/2026
+* Description      : Marks the start of a unit cycle.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN statsUnitArmed
+void statsUnitArmed(void)
+{
+	statsArmedTick = platformGetSysTick();
+	statsArmed = true;
+}
+// END statsUnitArmed
+
+
+
+
+
+/****************************************************************************
+* Function Name    : statsUnitWriteStart
+* Date             : 10/19/2026
+* Description      : Marks the start of the RF programming of a unit.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN statsUnitWriteStart
+void statsUnitWriteStart(void)
+{
+	statsWriteTick = platformGetSysTick();
+}
+// END statsUnitWriteStart
+
+
+
+
+
+/****************************************************************************
+* Function Name    : statsUnitWriteDone
+* Date             : 10/19/2026
+* Description      : Marks the end of the RF programming of a unit.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN statsUnitWriteDone
+void statsUnitWriteDone(void)
+{
+	statsAdd(&statsWrite, (uint32_t)(platformGetSysTick() - statsWriteTick));
+}
+// END statsUnitWriteDone
+
+
+
+
+
+/****************************************************************************
+* Function Name    : statsUnitDone
+* Date             : 10/19/2026
+* Description      : Marks the end of a unit cycle.
+*
+* Input Parameters : pass, true if the unit was programmed successfully
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN statsUnitDone
+void statsUnitDone(bool pass)
+{
+	uint32_t now = platformGetSysTick();
+	uint32_t cycle;
+	uint32_t bucket;
+
+	if (pass)
+	{
+		statsPass++;
+	}
+	else
+	{
+		statsFail++;
+	}
+
+	// A program command sent while a tag was already in the field is not armed separately
+	cycle = (uint32_t)(now - (statsArmed ? statsArmedTick : statsWriteTick));
+	statsAdd(&statsCycle, cycle);
+	statsArmed = false;
+
+	bucket = MIN((cycle / STATS_HIST_MS), (STATS_HIST_BUCKETS - 1U));
+	if (statsCycleHist[bucket] < UINT16_MAX)
+	{
+		statsCycleHist[bucket]++;
+	}
+
+	if ((statsPass + statsFail) == 1U)
+	{
+		statsFirstDoneTick = now;
+	}
+	statsLastDoneTick = now;
+}
+// END statsUnitDone
+
+
+
+
+
+/****************************************************************************
+* Function Name    : statsReport
+* Date             : 10/19/2026
+* Description      : Sends the station statistics via the UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN statsReport
+void statsReport(void)
+{
+	uint32_t units = (statsPass + statsFail);
+	uint32_t uph   = 0;
+	uint32_t seen  = 0;
+	uint32_t i;
+
+	platformLog("Units: %lu, pass %lu, fail %lu, pass rate %lu%%\r\n",
+	            (unsigned long)units, (unsigned long)statsPass, (unsigned long)statsFail,
+	            (unsigned long)((units != 0U) ? ((statsPass * 100U) / units) : 0U));
+
+	statsPrint("Write", &statsWrite);
+	statsPrint("Cycle", &statsCycle);
+
+	// Upper edge of the bucket holding the percentile
+	for (i = 0; i < (STATS_HIST_BUCKETS - 1U); i++)
+	{
+		seen += statsCycleHist[i];
+		if ((seen * 100U) >= (statsCycle.count * STATS_PERCENTILE))
+		{
+			break;
+		}
+	}
+	platformLog("Cycle p%u ms: %s%lu\r\n", STATS_PERCENTILE, ((i == (STATS_HIST_BUCKETS - 1U)) ? ">" : "<="),
+	            (unsigned long)((i == (STATS_HIST_BUCKETS - 1U)) ? (i * STATS_HIST_MS) : ((i + 1U) * STATS_HIST_MS)));
+
+	// Projected throughput if cycles ran back to back
+	if (statsCycle.sum != 0U)
+	{
+		uph = (uint32_t)(((uint64_t)STATS_MS_PER_HOUR * statsCycle.count) / statsCycle.sum);
+	}
+	platformLog("Projected units/hour: %lu\r\n", (unsigned long)uph);
+
+	// Observed throughput, includes the time between cycles
+	uph = 0;
+	if ((units > 1U) && (statsLastDoneTick != statsFirstDoneTick))
+	{
+		uph = (uint32_t)(((uint64_t)STATS_MS_PER_HOUR * (units - 1U)) / (uint32_t)(statsLastDoneTick - statsFirstDoneTick));
+	}
+	platformLog("Observed units/hour: %lu\r\n", (unsigned long)uph);
+
+	bootReport();
+
+#if UID_HISTORY
+	uidHistoryReport();
+#endif
+
+#if DEBUG_OUTPUT
+	faultInjectReport();
+#endif
+}
+// END statsReport
+
+
+
+
+
+/****************************************************************************
+* Function Name    : statsReset
+* Date             : 10/19/2026
+* Description      : Clears all station statistics.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN statsReset
+void statsReset(void)
+{
+	ST_MEMSET(&statsWrite, 0, sizeof(statsWrite));
+	ST_MEMSET(&statsCycle, 0, sizeof(statsCycle));
+	ST_MEMSET(statsCycleHist, 0, sizeof(statsCycleHist));
+	statsPass  = 0;
+	statsFail  = 0;
+	statsArmed = false;
+}
+// END statsReset
+
+
+
+
+
+/****************************************************************************
+* Function Name    : statsAdd
+* Date             : 10/19/2026
+* Description      : Adds one sample to a time statistic.
+*
+* Input Parameters : t, statistic to update
+* 					 ms, sample in ms
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN statsAdd
+static void statsAdd( StatsTime *t, uint32_t ms )
+{
+	if ((t->count == 0U) || (ms < t->min))
+	{
+		t->min = ms;
+	}
+	t->max = MAX(t->max, ms);
+	t->sum += ms;
+	t->count++;
+}
+// END statsAdd
+
+
+
+
+
+/****************************************************************************
+* Function Name    : statsPrint
+* Date             : 10/19/2026
+* Description      : Sends one time statistic via the UART interface.
+*
+* Input Parameters : name, name of the statistic
+* 					 t, statistic to send
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN statsPrint
+static void statsPrint( const char *name, const StatsTime *t )
+{
+	uint32_t avg = ((t->count != 0U) ? (t->sum / t->count) : 0U);
+
+	platformLog("%s ms: min %lu, avg %lu, max %lu\r\n", name,
+	            (unsigned long)t->min, (unsigned long)avg, (unsigned long)t->max);
+}
+// END statsPrint
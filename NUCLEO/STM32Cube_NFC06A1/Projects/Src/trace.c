@@ -0,0 +1,414 @@
+/*********************************************************************************
+* File Name :	trace.c
+* Description: Production trace implementation file
+*		          A ring of TRACE_DEPTH fixed size entries, the oldest one is
+*		          overwritten once the ring is full. Entries are only written
+*		          from the main loop (RFAL blocking calls and tagFinder), so
+*		          no locking is needed.
+*		          The dump names the NFC-V commands and ends with a summary
+*		          per command, so the round trips of a programming flow can
+*		          be counted without a host side decoder.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "trace.h"
+#include "logger.h"
+#include "utils.h"
+#include "fault_inject.h"
+#include "rf_probe.h"
+#include "rfal_nfcv.h"
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define TRACE_CMD_POS        1U     // position of the command code in an NFC-V request
+#define TRACE_CRC_LEN        2U     // CRC added on TX and removed on RX by the RFAL, still on air
+#define TRACE_LAT_BUCKETS    5U     // buckets of the per command latency distribution
+
+
+
+
+
+/* ------------------------- Private Types ------------------------- */
+typedef struct
+{
+	uint32_t tick;		// platformGetSysTick at the end of the event
+	uint16_t durUs;		// duration of an RF transceive in us
+	uint16_t ret;		// result code
+	uint8_t  kind;		// TRACE_RF, TRACE_UART_RX or TRACE_UART_TX
+	uint8_t  cmd;		// NFC-V or UART command code
+	uint8_t  txLen;		// bytes sent, saturated at 255
+	uint8_t  rxLen;		// bytes received, saturated at 255
+} TraceEntry;
+
+typedef struct
+{
+	uint8_t     cmd;	// NFC-V command code
+	const char *name;	// name printed in the dump
+} TraceCmdName;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static TraceEntry traceRing[TRACE_DEPTH];	// trace entries
+static uint16_t   traceHead;				// next entry to write
+static bool       traceWrapped;				// ring has been filled at least once
+static uint16_t   traceRfStartUs;			// start of the current RF transceive
+
+static const uint16_t traceLatBucketUs[TRACE_LAT_BUCKETS - 1U] = { 1000U, 2000U, 5000U, 10000U };	// upper edges, the last bucket holds the rest
+
+static const TraceCmdName traceCmdNames[] =
+{
+	{ (uint8_t)RFAL_NFCV_CMD_INVENTORY,                          "Inventory"           },
+	{ (uint8_t)RFAL_NFCV_CMD_SLPV,                               "StayQuiet"           },
+	{ (uint8_t)RFAL_NFCV_CMD_READ_SINGLE_BLOCK,                  "ReadSingle"          },
+	{ (uint8_t)RFAL_NFCV_CMD_WRITE_SINGLE_BLOCK,                 "WriteSingle"         },
+	{ (uint8_t)RFAL_NFCV_CMD_READ_MULTIPLE_BLOCKS,               "ReadMultiple"        },
+	{ (uint8_t)RFAL_NFCV_CMD_WRITE_MULTIPLE_BLOCKS,              "WriteMultiple"       },
+	{ (uint8_t)RFAL_NFCV_CMD_SELECT,                             "Select"              },
+	{ (uint8_t)RFAL_NFCV_CMD_RESET_TO_READY,                     "ResetToReady"        },
+	{ (uint8_t)RFAL_NFCV_CMD_GET_SYS_INFO,                       "GetSysInfo"          },
+	{ (uint8_t)RFAL_NFCV_CMD_EXTENDED_READ_SINGLE_BLOCK,         "ExtReadSingle"       },
+	{ (uint8_t)RFAL_NFCV_CMD_EXTENDED_WRITE_SINGLE_BLOCK,        "ExtWriteSingle"      },
+	{ (uint8_t)RFAL_NFCV_CMD_EXTENDED_READ_MULTIPLE_BLOCK,       "ExtReadMultiple"     },
+	{ (uint8_t)RFAL_NFCV_CMD_EXTENDED_WRITE_MULTIPLE_BLOCK,      "ExtWriteMultiple"    },
+	{ (uint8_t)RFAL_NFCV_CMD_EXTENDED_GET_SYS_INFO,              "ExtGetSysInfo"       },
+	{ (uint8_t)RFAL_NFCV_CMD_READ_CONFIGURATION,                 "ReadCfg"             },
+	{ (uint8_t)RFAL_NFCV_CMD_WRITE_CONFIGURATION,                "WriteCfg"            },
+	{ (uint8_t)RFAL_NFCV_CMD_READ_DYN_CONFIGURATION,             "ReadDynCfg"          },
+	{ (uint8_t)RFAL_NFCV_CMD_WRITE_DYN_CONFIGURATION,            "WriteDynCfg"         },
+	{ (uint8_t)RFAL_NFCV_CMD_WRITE_PASSWORD,                     "WritePwd"            },
+	{ (uint8_t)RFAL_NFCV_CMD_PRESENT_PASSWORD,                   "PresentPwd"          },
+	{ (uint8_t)RFAL_NFCV_CMD_FAST_READ_SINGLE_BLOCK,             "FastReadSingle"      },
+	{ (uint8_t)RFAL_NFCV_CMD_FAST_READ_MULTIPLE_BLOCKS,          "FastReadMultiple"    },
+	{ (uint8_t)RFAL_NFCV_CMD_FAST_EXTENDED_READ_SINGLE_BLOCK,    "FastExtReadSingle"   },
+	{ (uint8_t)RFAL_NFCV_CMD_FAST_EXTENDED_READ_MULTIPLE_BLOCKS, "FastExtReadMultiple" },
+	{ (uint8_t)RFAL_NFCV_CMD_FAST_WRITE_MESSAGE,                 "FastWriteMsg"        },
+	{ (uint8_t)RFAL_NFCV_CMD_FAST_READ_DYN_CONFIGURATION,        "FastReadDynCfg"      },
+	{ (uint8_t)RFAL_NFCV_CMD_FAST_WRITE_DYN_CONFIGURATION,       "FastWriteDynCfg"     },
+};
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static void traceAdd( uint8_t kind, uint8_t cmd, uint16_t txLen, uint16_t rxLen, ReturnCode ret, uint16_t durUs );
+static const TraceEntry *traceAt( uint16_t i );
+static const char *traceCmdName( uint8_t kind, uint8_t cmd );
+static void traceSummary( uint16_t count );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : traceRfStart
+* Date             : 10/19/2026
+* Description      : Marks the start of a blocking RF transceive.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN traceRfStart
+void traceRfStart(void)
+{
+	traceRfStartUs = platformGetSysTickUs();
+
+#if DEBUG_OUTPUT
+	faultInjectTxRxStart();
+#endif
+}
+// END traceRfStart
+
+
+
+
+
+/****************************************************************************
+* Function Name    : traceRfEnd
+* Date             : 10/19/2026
+* Description      : Records a blocking RF transceive.
+*
+* Input Parameters : ret, result of the transceive
+* 					 txBuf, transmitted frame (flags, command, ...)
+* 					 txLen, length of txBuf in bytes
+* 					 rxLen, received bytes
+*
+* Return		   : result of the transceive
+*
+*****************************************************************************/
+
+// BEGIN traceRfEnd
+ReturnCode traceRfEnd(ReturnCode ret, const uint8_t *txBuf, uint16_t txLen, uint16_t rxLen)
+{
+	uint16_t durUs = (uint16_t)(platformGetSysTickUs() - traceRfStartUs);
+	uint8_t  cmd   = ((txLen > TRACE_CMD_POS) ? txBuf[TRACE_CMD_POS] : 0U);
+
+#if DEBUG_OUTPUT
+	ret = faultInjectTxRxEnd(ret, txBuf, txLen);
+#endif
+
+	traceAdd(TRACE_RF, cmd, txLen, rxLen, ret, durUs);
+
+#if RF_PROBE
+	rfProbeRecord(cmd, txLen, rxLen, ret, durUs);
+#endif
+
+	return ret;
+}
+// END traceRfEnd
+
+
+
+
+
+/****************************************************************************
+* Function Name    : traceUart
+* Date             : 10/19/2026
+* Description      : Records a UART command or a result sent to the UI.
+*
+* Input Parameters : kind, TRACE_UART_RX or TRACE_UART_TX
+* 					 cmd, command code or result code
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN traceUart
+void traceUart(uint8_t kind, uint8_t cmd)
+{
+	traceAdd(kind, cmd, 0, 0, ERR_NONE, 0);
+}
+// END traceUart
+
+
+
+
+
+/****************************************************************************
+* Function Name    : traceDump
+* Date             : 10/19/2026
+* Description      : Sends the trace via the UART interface, oldest first.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN traceDump
+void traceDump(void)
+{
+	uint16_t i;
+	uint16_t count = (traceWrapped ? TRACE_DEPTH : traceHead);
+	const TraceEntry *e;
+
+	platformLog("Trace: %u entries\r\n", count);
+
+	for (i = 0; i < count; i++)
+	{
+		e = traceAt(i);
+
+		platformLog("%lu,%c,%02X,%s,%u,%u,%u,%u\r\n", (unsigned long)e->tick, e->kind, e->cmd,
+		            traceCmdName(e->kind, e->cmd), e->txLen, e->rxLen, e->ret, e->durUs);
+	}
+
+	traceSummary(count);
+}
+// END traceDump
+
+
+
+
+
+/****************************************************************************
+* Function Name    : traceAdd
+* Date             : 10/19/2026
+* Description      : Writes one entry into the ring.
+*
+* Input Parameters : kind, entry kind
+* 					 cmd, command code
+* 					 txLen, bytes sent
+* 					 rxLen, bytes received
+* 					 ret, result code
+* 					 durUs, duration in us
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN traceAdd
+static void traceAdd( uint8_t kind, uint8_t cmd, uint16_t txLen, uint16_t rxLen, ReturnCode ret, uint16_t durUs )
+{
+	TraceEntry *e = &traceRing[traceHead];
+
+	e->tick  = platformGetSysTick();
+	e->durUs = durUs;
+	e->ret   = (uint16_t)ret;
+	e->kind  = kind;
+	e->cmd   = cmd;
+	e->txLen = (uint8_t)MIN(txLen, UINT8_MAX);
+	e->rxLen = (uint8_t)MIN(rxLen, UINT8_MAX);
+
+	traceHead++;
+	if (traceHead >= TRACE_DEPTH)
+	{
+		traceHead = 0;
+		traceWrapped = true;
+	}
+}
+// END traceAdd
+
+
+
+
+
+/****************************************************************************
+* Function Name    : traceAt
+* Date             : 10/19/2026
+* Description      : Returns an entry of the ring, oldest first.
+*
+* Input Parameters : i, position counted from the oldest entry
+*
+* Return		   : entry
+*
+*****************************************************************************/
+
+// BEGIN traceAt
+static const TraceEntry *traceAt( uint16_t i )
+{
+	return &traceRing[(traceWrapped ? (traceHead + i) : i) % TRACE_DEPTH];
+}
+// END traceAt
+
+
+
+
+
+/****************************************************************************
+* Function Name    : traceCmdName
+* Date             : 10/19/2026
+* Description      : Looks up the name of an NFC-V command.
+*
+* Input Parameters : kind, entry kind
+* 					 cmd, command code
+*
+* Return		   : name, "-" for UART entries and unknown commands
+*
+*****************************************************************************/
+
+// BEGIN traceCmdName
+static const char *traceCmdName( uint8_t kind, uint8_t cmd )
+{
+	uint8_t i;
+
+	if (kind == TRACE_RF)
+	{
+		for (i = 0; i < (sizeof(traceCmdNames) / sizeof(traceCmdNames[0])); i++)
+		{
+			if (traceCmdNames[i].cmd == cmd)
+			{
+				return traceCmdNames[i].name;
+			}
+		}
+	}
+
+	return "-";
+}
+// END traceCmdName
+
+
+
+
+
+/****************************************************************************
+* Function Name    : traceSummary
+* Date             : 10/19/2026
+* Description      : Sends one line per NFC-V command found in the ring:
+* 						round trips, bytes on air (CRC included) and the
+* 						latency distribution. Worked out from the ring at
+* 						dump time, so it costs no RAM.
+*
+* Input Parameters : count, entries in the ring
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN traceSummary
+static void traceSummary( uint16_t count )
+{
+	uint16_t i;
+	uint16_t j;
+	uint8_t  b;
+	uint16_t n;
+	uint32_t bytes;
+	uint32_t sumUs;
+	uint16_t maxUs;
+	uint16_t hist[TRACE_LAT_BUCKETS];
+	const TraceEntry *e;
+	const TraceEntry *f;
+
+	platformLog("cmd,name,count,bytesOnAir,avgUs,maxUs,<1ms,<2ms,<5ms,<10ms,>=10ms\r\n");
+
+	for (i = 0; i < count; i++)
+	{
+		e = traceAt(i);
+
+		// Only the first entry of each RF command opens a summary line
+		for (j = 0; j < i; j++)
+		{
+			f = traceAt(j);
+			if ((f->kind == TRACE_RF) && (f->cmd == e->cmd))
+			{
+				break;
+			}
+		}
+		if ((e->kind != TRACE_RF) || (j < i))
+		{
+			continue;
+		}
+
+		n     = 0;
+		bytes = 0;
+		sumUs = 0;
+		maxUs = 0;
+		ST_MEMSET(hist, 0, sizeof(hist));
+
+		for (j = i; j < count; j++)
+		{
+			f = traceAt(j);
+			if ((f->kind != TRACE_RF) || (f->cmd != e->cmd))
+			{
+				continue;
+			}
+
+			n++;
+			bytes += (uint32_t)f->txLen + TRACE_CRC_LEN + ((f->rxLen != 0U) ? ((uint32_t)f->rxLen + TRACE_CRC_LEN) : 0U);
+			sumUs += f->durUs;
+			maxUs  = MAX(maxUs, f->durUs);
+
+			for (b = 0; b < (TRACE_LAT_BUCKETS - 1U); b++)
+			{
+				if (f->durUs < traceLatBucketUs[b])
+				{
+					break;
+				}
+			}
+			hist[b]++;
+		}
+
+		platformLog("%02X,%s,%u,%lu,%lu,%u,%u,%u,%u,%u,%u\r\n", e->cmd, traceCmdName(TRACE_RF, e->cmd), n,
+		            (unsigned long)bytes, (unsigned long)(sumUs / n), maxUs,
+		            hist[0], hist[1], hist[2], hist[3], hist[4]);
+	}
+}
+// END traceSummary
@@ -0,0 +1,306 @@
+/*********************************************************************************
+* File Name :	uid_history.c
+* Description: Unit history implementation file
+*		          Open addressed hash table: a UID is only ever looked for in
+*		          the UID_HISTORY_PROBES slots following its home slot, so
+*		          a lookup costs the same whether the table is empty or
+*		          full. When all of these slots are used the oldest unit
+*		          among them is forgotten; nothing is ever removed
+*		          otherwise, so no slot needs a deleted marker.
+*
+**********************************************************************************/
+
+/* ------------------------- Includes ------------------------- */
+#include "uid_history.h"
+#include "logger.h"
+#include "utils.h"
+#include <string.h>
+
+#if UID_HISTORY
+
+
+
+
+/* ------------------------- DEFINES ------------------------- */
+#define UID_HISTORY_UID_LEN      8U              // ISO15693 UID length
+#define UID_HISTORY_FNV_BASIS    2166136261UL    // FNV-1a offset basis
+#define UID_HISTORY_FNV_PRIME    16777619UL      // FNV-1a prime
+
+#define UID_RESULT_EMPTY         0U              // slot not used
+#define UID_RESULT_PASS          1U              // unit programmed and verified
+#define UID_RESULT_FAIL          2U              // unit programming failed
+
+
+
+
+
+/* ------------------------- Private Types ------------------------- */
+typedef struct
+{
+	uint8_t  uid[UID_HISTORY_UID_LEN];	// UID as received in the inventory
+	uint16_t recipe;					// hash of the recipe last programmed
+	uint8_t  result;					// UID_RESULT_xxx
+	uint8_t  stamp;						// uidHistoryGen when last stored
+} UidEntry;
+
+
+
+
+
+/* ------------------------- Private Variables ------------------------- */
+static UidEntry uidHistory[UID_HISTORY_SLOTS];	// the units remembered
+static uint8_t  uidHistoryGen;					// incremented on each store, ages the entries
+
+static uint32_t uidHistoryDone;					// units acknowledged without programming
+static uint32_t uidHistoryChanged;				// units programmed again with another recipe
+static uint32_t uidHistoryRetried;				// units programmed again after a failure
+
+
+
+
+
+/* ------------------------- Private Function Prototypes ------------------------- */
+static uint8_t   uidHistoryHome( const uint8_t *uid );
+static UidEntry *uidHistoryFind( const uint8_t *uid );
+
+
+
+
+
+/****************************************************************************
+* Function Name    : uidHistoryCheck
+* Date             : 10/19/2026
+* Description      : Looks the unit up and counts it as already done,
+* 						changed recipe or failed before.
+*
+* Input Parameters : uid, UID of the unit as received in the inventory
+* 					 recipe, hash of the recipe about to be programmed
+*
+* Return		   : UID_HISTORY_xxx state of the unit
+*
+*****************************************************************************/
+
+// BEGIN uidHistoryCheck
+uint8_t uidHistoryCheck(const uint8_t *uid, uint16_t recipe)
+{
+	const UidEntry *entry = uidHistoryFind(uid);
+
+	if (entry == NULL)
+	{
+		return UID_HISTORY_NEW;
+	}
+
+	if (entry->result == UID_RESULT_FAIL)
+	{
+		uidHistoryRetried++;
+		return UID_HISTORY_FAILED;
+	}
+
+	if (entry->recipe != recipe)
+	{
+		uidHistoryChanged++;
+		return UID_HISTORY_CHANGED;
+	}
+
+	uidHistoryDone++;
+	return UID_HISTORY_DONE;
+}
+// END uidHistoryCheck
+
+
+
+
+
+/****************************************************************************
+* Function Name    : uidHistoryStore
+* Date             : 10/19/2026
+* Description      : Keeps the result of a unit programming, in the slot of
+* 						the unit if it is known, else in a free slot, else
+* 						in place of the oldest unit of its probe range.
+*
+* Input Parameters : uid, UID of the unit as received in the inventory
+* 					 recipe, hash of the recipe programmed
+* 					 pass, true if the unit was programmed and verified
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN uidHistoryStore
+void uidHistoryStore(const uint8_t *uid, uint16_t recipe, bool pass)
+{
+	UidEntry *entry = uidHistoryFind(uid);
+	UidEntry *slot;
+	uint8_t   home;
+	uint8_t   i;
+
+	uidHistoryGen++;
+
+	if (entry == NULL)
+	{
+		home = uidHistoryHome(uid);
+		for (i = 0; i < UID_HISTORY_PROBES; i++)
+		{
+			slot = &uidHistory[(home + i) & (UID_HISTORY_SLOTS - 1U)];
+			if (slot->result == UID_RESULT_EMPTY)
+			{
+				entry = slot;
+				break;
+			}
+
+			// Oldest is the longest ago in generations, wraps with the counter
+			if ((entry == NULL) || ((uint8_t)(uidHistoryGen - slot->stamp) > (uint8_t)(uidHistoryGen - entry->stamp)))
+			{
+				entry = slot;
+			}
+		}
+
+		ST_MEMCPY(entry->uid, uid, UID_HISTORY_UID_LEN);
+	}
+
+	entry->recipe = recipe;
+	entry->result = (pass ? UID_RESULT_PASS : UID_RESULT_FAIL);
+	entry->stamp  = uidHistoryGen;
+}
+// END uidHistoryStore
+
+
+
+
+
+/****************************************************************************
+* Function Name    : uidHistoryFlag
+* Date             : 10/19/2026
+* Description      : Tells the host about a unit seen before, one line with
+* 						the UID then DUPLICATE for a unit that already got
+* 						this recipe or failed it, REPLACED for a unit whose
+* 						recipe is being replaced. Nothing is sent for a new
+* 						unit.
+*
+* Input Parameters : uid, UID of the unit as received in the inventory
+* 					 state, UID_HISTORY_xxx state from uidHistoryCheck
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN uidHistoryFlag
+void uidHistoryFlag(const uint8_t *uid, uint8_t state)
+{
+	uint8_t label[UID_HISTORY_UID_LEN];
+
+	if (state == UID_HISTORY_NEW)
+	{
+		return;
+	}
+
+	// UID shown most significant byte first, as on the unit label
+	ST_MEMCPY(label, uid, UID_HISTORY_UID_LEN);
+	REVERSE_BYTES(label, UID_HISTORY_UID_LEN);
+	platformLog("%s %s\n", hex2Str(label, UID_HISTORY_UID_LEN), (state == UID_HISTORY_CHANGED) ? "REPLACED" : "DUPLICATE");
+}
+// END uidHistoryFlag
+
+
+
+
+
+/****************************************************************************
+* Function Name    : uidHistoryReport
+* Date             : 10/19/2026
+* Description      : Sends the unit history counts via the UART interface.
+*
+* Input Parameters : none
+*
+* Return		   : none
+*
+*****************************************************************************/
+
+// BEGIN uidHistoryReport
+void uidHistoryReport(void)
+{
+	uint8_t used = 0;
+	uint8_t i;
+
+	for (i = 0; i < UID_HISTORY_SLOTS; i++)
+	{
+		if (uidHistory[i].result != UID_RESULT_EMPTY)
+		{
+			used++;
+		}
+	}
+
+	platformLog("Unit history: %u of %u, already done %lu, recipe changed %lu, failed before %lu\r\n",
+	            used, UID_HISTORY_SLOTS, (unsigned long)uidHistoryDone, (unsigned long)uidHistoryChanged,
+	            (unsigned long)uidHistoryRetried);
+}
+// END uidHistoryReport
+
+
+
+
+
+/****************************************************************************
+* Function Name    : uidHistoryHome
+* Date             : 10/19/2026
+* Description      : Home slot of a UID, FNV-1a hash over the whole UID so
+* 						the serial numbers of one reel spread over the table.
+*
+* Input Parameters : uid, UID of the unit as received in the inventory
+*
+* Return		   : index of the first slot to look at
+*
+*****************************************************************************/
+
+// BEGIN uidHistoryHome
+static uint8_t uidHistoryHome( const uint8_t *uid )
+{
+	uint32_t hash = UID_HISTORY_FNV_BASIS;
+	uint8_t  i;
+
+	for (i = 0; i < UID_HISTORY_UID_LEN; i++)
+	{
+		hash ^= uid[i];
+		hash *= UID_HISTORY_FNV_PRIME;
+	}
+
+	return (uint8_t)(hash & (UID_HISTORY_SLOTS - 1U));
+}
+// END uidHistoryHome
+
+
+
+
+
+/****************************************************************************
+* Function Name    : uidHistoryFind
+* Date             : 10/19/2026
+* Description      : Looks for the UID in its probe range.
+*
+* Input Parameters : uid, UID of the unit as received in the inventory
+*
+* Return		   : entry of the unit, NULL if it is not remembered
+*
+*****************************************************************************/
+
+// BEGIN uidHistoryFind
+static UidEntry *uidHistoryFind( const uint8_t *uid )
+{
+	UidEntry *slot;
+	uint8_t   home = uidHistoryHome(uid);
+	uint8_t   i;
+
+	for (i = 0; i < UID_HISTORY_PROBES; i++)
+	{
+		slot = &uidHistory[(home + i) & (UID_HISTORY_SLOTS - 1U)];
+		if ((slot->result != UID_RESULT_EMPTY) && (memcmp(slot->uid, uid, UID_HISTORY_UID_LEN) == 0))
+		{
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+// END uidHistoryFind
+
+#endif /* UID_HISTORY */